@@ -9,7 +9,24 @@ static_assert(ARDUINOJSON_LITTLE_ENDIAN == 1, "ARDUINOJSON_LITTLE_ENDIAN");
 
 static_assert(ARDUINOJSON_USE_DOUBLE == 1, "ARDUINOJSON_USE_DOUBLE");
 
+static_assert(ARDUINOJSON_SLOT_KEY_HASH == 1, "ARDUINOJSON_SLOT_KEY_HASH");
+
+static_assert(ARDUINOJSON_SLOT_KEY_SIZE == 1, "ARDUINOJSON_SLOT_KEY_SIZE");
+
 static_assert(sizeof(ARDUINOJSON_NAMESPACE::VariantSlot) == 32,
               "sizeof(VariantSlot)");
 
+// The hash and the size of the key go in the padding, so that
+// JSON_OBJECT_SIZE() doesn't change
+struct SlotWithoutKeyInfo {
+  ARDUINOJSON_NAMESPACE::VariantContent content;
+  uint8_t flags;
+  ARDUINOJSON_NAMESPACE::VariantSlotDiff next;
+  const char* key;
+};
+
+static_assert(sizeof(ARDUINOJSON_NAMESPACE::VariantSlot) ==
+                  sizeof(SlotWithoutKeyInfo),
+              "sizeof(VariantSlot) with the key hash and size");
+
 int main() {}
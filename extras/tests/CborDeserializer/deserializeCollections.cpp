@@ -0,0 +1,65 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+template <size_t N>
+static void check(const char (&input)[N], const char* expectedJson) {
+  DynamicJsonDocument doc(4096);
+
+  DeserializationError error = deserializeCbor(doc, input, N - 1);
+
+  REQUIRE(error == DeserializationError::Ok);
+  REQUIRE(doc.as<std::string>() == expectedJson);
+}
+
+TEST_CASE("deserialize CBOR array") {
+  SECTION("empty") {
+    check("\x80", "[]");
+  }
+
+  SECTION("[1,2,3]") {
+    check("\x83\x01\x02\x03", "[1,2,3]");
+  }
+
+  SECTION("nested") {
+    check("\x83\x01\x82\x02\x03\x82\x04\x05", "[1,[2,3],[4,5]]");
+  }
+
+  SECTION("25 elements") {
+    check(
+        "\x98\x19\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f"
+        "\x10\x11\x12\x13\x14\x15\x16\x17\x18\x18\x18\x19",
+        "[1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25]");
+  }
+
+  SECTION("indefinite length") {
+    check("\x9F\xFF", "[]");
+    check("\x9F\x01\x82\x02\x03\x9F\x04\x05\xFF\xFF", "[1,[2,3],[4,5]]");
+    check("\x83\x01\x82\x02\x03\x9F\x04\x05\xFF", "[1,[2,3],[4,5]]");
+  }
+}
+
+TEST_CASE("deserialize CBOR map") {
+  SECTION("empty") {
+    check("\xA0", "{}");
+  }
+
+  SECTION("{\"a\":1,\"b\":[2,3]}") {
+    check("\xA2\x61\x61\x01\x61\x62\x82\x02\x03", "{\"a\":1,\"b\":[2,3]}");
+  }
+
+  SECTION("indefinite length") {
+    check("\xBF\x63\x46un\xF5\x63\x41mt\x21\xFF", "{\"Fun\":true,\"Amt\":-2}");
+  }
+
+  SECTION("indefinite-length key") {
+    check("\xA1\x7F\x61\x61\x61\x62\xFF\x01", "{\"ab\":1}");
+  }
+
+  SECTION("tagged key") {
+    check("\xA1\xC0\x61\x61\x01", "{\"a\":1}");
+  }
+}
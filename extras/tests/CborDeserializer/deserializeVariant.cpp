@@ -0,0 +1,161 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+template <typename T, typename U, size_t N>
+static void check(const char (&input)[N], U expected) {
+  DynamicJsonDocument doc(4096);
+
+  DeserializationError error = deserializeCbor(doc, input, N - 1);
+
+  REQUIRE(error == DeserializationError::Ok);
+  REQUIRE(doc.is<T>());
+  REQUIRE(doc.as<T>() == expected);
+}
+
+template <size_t N>
+static void checkIsNull(const char (&input)[N]) {
+  DynamicJsonDocument doc(4096);
+
+  DeserializationError error = deserializeCbor(doc, input, N - 1);
+
+  REQUIRE(error == DeserializationError::Ok);
+  REQUIRE(doc.as<JsonVariant>().isNull());
+}
+
+TEST_CASE("deserialize CBOR value") {
+  SECTION("null") {
+    checkIsNull("\xF6");
+  }
+
+  SECTION("undefined") {
+    checkIsNull("\xF7");
+  }
+
+  SECTION("simple values") {
+    checkIsNull("\xE0");
+    checkIsNull("\xF8\xFF");
+  }
+
+  SECTION("bool") {
+    check<bool>("\xF4", false);
+    check<bool>("\xF5", true);
+  }
+
+  SECTION("unsigned integer") {
+    check<int>("\x00", 0);
+    check<int>("\x17", 23);
+    check<int>("\x18\x18", 24);
+    check<int>("\x19\x03\xE8", 1000);
+    check<uint32_t>("\x1A\xFF\xFF\xFF\xFF", 4294967295U);
+    check<int>("\x1B\x00\x00\x00\x00\x00\x00\x00\x01", 1);
+  }
+
+  SECTION("negative integer") {
+    check<int>("\x20", -1);
+    check<int>("\x29", -10);
+    check<int>("\x38\x63", -100);
+    check<int>("\x39\x03\xE7", -1000);
+    check<int32_t>("\x3A\x7F\xFF\xFF\xFF", -2147483647 - 1);
+  }
+
+#if ARDUINOJSON_USE_LONG_LONG
+  SECTION("64-bit integers") {
+    check<uint64_t>("\x1B\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF",
+                    18446744073709551615ULL);
+    check<int64_t>("\x3B\x7F\xFF\xFF\xFF\xFF\xFF\xFF\xFF",
+                   -9223372036854775807LL - 1);
+  }
+#endif
+
+  SECTION("negative integer too small") {
+    checkIsNull("\x3B\x80\x00\x00\x00\x00\x00\x00\x00");
+  }
+
+  SECTION("half-precision float") {
+    check<float>("\xF9\x00\x00", 0.0f);
+    check<float>("\xF9\x3C\x00", 1.0f);
+    check<float>("\xF9\x3E\x00", 1.5f);
+    check<float>("\xF9\xC4\x00", -4.0f);
+    check<float>("\xF9\x7B\xFF", 65504.0f);
+  }
+
+  SECTION("single-precision float") {
+    check<float>("\xFA\x47\xC3\x50\x00", 100000.0f);
+    check<float>("\xFA\x3F\xC0\x00\x00", 1.5f);
+  }
+
+  SECTION("double-precision float") {
+    check<double>("\xFB\x3F\xF1\x99\x99\x99\x99\x99\x9A", 1.1);
+    check<double>("\xFB\xC0\x10\x66\x66\x66\x66\x66\x66", -4.1);
+  }
+
+  SECTION("text string") {
+    check<const char*>("\x60", std::string(""));
+    check<const char*>("\x61\x61", std::string("a"));
+    check<const char*>("\x64IETF", std::string("IETF"));
+    check<const char*>("\x78\x05hello", std::string("hello"));
+  }
+
+  SECTION("indefinite-length text string") {
+    check<const char*>("\x7F\x65strea\x64ming\xFF", std::string("streaming"));
+    check<const char*>("\x7F\xFF", std::string(""));
+  }
+
+  SECTION("byte string") {
+    DynamicJsonDocument doc(4096);
+    deserializeCbor(doc, "\x44\x01\x02\x03\x04", 5);
+
+    REQUIRE(doc.is<MsgPackBinary>());
+    MsgPackBinary bin = doc.as<MsgPackBinary>();
+    REQUIRE(std::string(reinterpret_cast<const char*>(bin.data()),
+                        bin.size()) == "\x01\x02\x03\x04");
+  }
+
+  SECTION("extension") {
+    DynamicJsonDocument doc(4096);
+    deserializeCbor(doc, "\xDA\x4D\x50\x00\xFF\x42\x01\x02", 8);
+
+    REQUIRE(doc.is<MsgPackExtension>());
+    MsgPackExtension ext = doc.as<MsgPackExtension>();
+    REQUIRE(ext.type() == -1);
+    REQUIRE(ext.size() == 2);
+    REQUIRE(ext.data()[1] == 2);
+  }
+
+  SECTION("extension in zero-copy mode") {
+    DynamicJsonDocument doc(4096);
+    char input[] = "\xDA\x4D\x50\x00\x05\x41\x07";
+    deserializeCbor(doc, input, 7);
+
+    MsgPackExtension ext = doc.as<MsgPackExtension>();
+    REQUIRE(ext.type() == 5);
+    REQUIRE(ext.size() == 1);
+    REQUIRE(ext.data()[0] == 7);
+  }
+
+  SECTION("another tag on a byte string") {
+    DynamicJsonDocument doc(4096);
+    deserializeCbor(doc, "\xDA\x4D\x50\x01\x00\x41\x07", 7);
+
+    REQUIRE(doc.is<MsgPackBinary>());
+  }
+
+  SECTION("indefinite-length byte string") {
+    DynamicJsonDocument doc(4096);
+    deserializeCbor(doc, "\x5F\x42\x01\x02\x43\x03\x04\x05\xFF", 9);
+
+    REQUIRE(doc.is<MsgPackBinary>());
+    REQUIRE(doc.as<MsgPackBinary>().size() == 5);
+  }
+
+  SECTION("tags are ignored") {
+    check<const char*>("\xC0\x74" "2013-03-21T20:04:00Z",
+                       std::string("2013-03-21T20:04:00Z"));
+    check<int>("\xC1\x1A\x51\x4B\x67\xB0", 1363896240);
+    check<int>("\xD8\x20\xD9\x01\x00\x0A", 10);
+  }
+}
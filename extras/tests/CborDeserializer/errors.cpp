@@ -0,0 +1,134 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+template <size_t N>
+static DeserializationError deserialize(const char (&input)[N],
+                                        size_t capacity = 4096) {
+  DynamicJsonDocument doc(capacity);
+  return deserializeCbor(doc, input, N - 1);
+}
+
+TEST_CASE("deserializeCbor() returns EmptyInput") {
+  DynamicJsonDocument doc(4096);
+
+  REQUIRE(deserializeCbor(doc, "", 0) == DeserializationError::EmptyInput);
+}
+
+TEST_CASE("deserializeCbor() returns IncompleteInput") {
+  SECTION("integer") {
+    REQUIRE(deserialize("\x19\x01") == DeserializationError::IncompleteInput);
+  }
+
+  SECTION("float") {
+    REQUIRE(deserialize("\xFA\x3F\xC0") ==
+            DeserializationError::IncompleteInput);
+  }
+
+  SECTION("string") {
+    REQUIRE(deserialize("\x64IET") == DeserializationError::IncompleteInput);
+  }
+
+  SECTION("indefinite-length string") {
+    REQUIRE(deserialize("\x7F\x61\x61") ==
+            DeserializationError::IncompleteInput);
+  }
+
+  SECTION("array") {
+    REQUIRE(deserialize("\x83\x01\x02") ==
+            DeserializationError::IncompleteInput);
+  }
+
+  SECTION("indefinite-length array") {
+    REQUIRE(deserialize("\x9F\x01\x02") ==
+            DeserializationError::IncompleteInput);
+  }
+
+  SECTION("map") {
+    REQUIRE(deserialize("\xA1\x61\x61") ==
+            DeserializationError::IncompleteInput);
+  }
+
+  SECTION("tag") {
+    REQUIRE(deserialize("\xC1") == DeserializationError::IncompleteInput);
+  }
+}
+
+TEST_CASE("deserializeCbor() returns InvalidInput") {
+  SECTION("reserved additional information") {
+    REQUIRE(deserialize("\x1C") == DeserializationError::InvalidInput);
+  }
+
+  SECTION("indefinite-length integer") {
+    REQUIRE(deserialize("\x1F") == DeserializationError::InvalidInput);
+  }
+
+  SECTION("unexpected break") {
+    REQUIRE(deserialize("\xFF") == DeserializationError::InvalidInput);
+    REQUIRE(deserialize("\x82\x01\xFF") == DeserializationError::InvalidInput);
+  }
+
+  SECTION("break instead of a value") {
+    REQUIRE(deserialize("\xBF\x61\x61\xFF") ==
+            DeserializationError::InvalidInput);
+  }
+
+  SECTION("non-string key") {
+    REQUIRE(deserialize("\xA1\x01\x02") == DeserializationError::InvalidInput);
+  }
+
+  SECTION("chunk of the wrong type") {
+    REQUIRE(deserialize("\x7F\x41\x61\xFF") ==
+            DeserializationError::InvalidInput);
+  }
+
+  SECTION("nested indefinite-length chunk") {
+    REQUIRE(deserialize("\x7F\x7F\xFF\xFF") ==
+            DeserializationError::InvalidInput);
+  }
+}
+
+TEST_CASE("deserializeCbor() returns NoMemory") {
+  SECTION("string") {
+    REQUIRE(deserialize("\x6A" "0123456789", 8) ==
+            DeserializationError::NoMemory);
+  }
+
+  SECTION("array") {
+    REQUIRE(deserialize("\x82\x01\x02", JSON_ARRAY_SIZE(1)) ==
+            DeserializationError::NoMemory);
+  }
+
+  SECTION("map") {
+    REQUIRE(deserialize("\xA2\x61\x61\x01\x61\x62\x02", JSON_OBJECT_SIZE(1)) ==
+            DeserializationError::NoMemory);
+  }
+}
+
+TEST_CASE("deserializeCbor() returns TooDeep") {
+  DynamicJsonDocument doc(4096);
+
+  SECTION("within the limit") {
+    DeserializationError err = deserializeCbor(
+        doc, "\x81\x81\x80", 3, DeserializationOption::NestingLimit(3));
+
+    REQUIRE(err == DeserializationError::Ok);
+  }
+
+  SECTION("beyond the limit") {
+    DeserializationError err = deserializeCbor(
+        doc, "\x81\x81\x80", 3, DeserializationOption::NestingLimit(2));
+
+    REQUIRE(err == DeserializationError::TooDeep);
+  }
+
+  SECTION("indefinite-length") {
+    DeserializationError err = deserializeCbor(
+        doc, "\x9F\xBF\xFF\xFF", 4, DeserializationOption::NestingLimit(1));
+
+    REQUIRE(err == DeserializationError::TooDeep);
+  }
+}
@@ -0,0 +1,52 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+TEST_CASE("deserializeCbor() filter") {
+  DynamicJsonDocument doc(4096);
+  StaticJsonDocument<256> filter;
+
+  SECTION("skips the members that are not in the filter") {
+    filter["b"] = true;
+
+    // {"a":[1,h'0102',"xy",{"c":1.5}],"b":42}
+    DeserializationError err = deserializeCbor(
+        doc,
+        "\xA2\x61\x61\x84\x01\x42\x01\x02\x62xy\xA1\x61\x63\xF9\x3E\x00"
+        "\x61\x62\x18\x2A",
+        21, DeserializationOption::Filter(filter));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "{\"b\":42}");
+  }
+
+  SECTION("skips indefinite-length items") {
+    filter["b"] = true;
+
+    // {_ "a":[_ (_ "x","y"), (_ h'01')], "b":true}
+    DeserializationError err = deserializeCbor(
+        doc,
+        "\xBF\x61\x61\x9F\x7F\x61x\x61y\xFF\x5F\x41\x01\xFF\xFF\x61\x62\xF5"
+        "\xFF",
+        19, DeserializationOption::Filter(filter));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "{\"b\":true}");
+  }
+
+  SECTION("filters the elements of an array") {
+    filter[0]["id"] = true;
+
+    // [{"id":1,"x":2},{"id":3,"x":4}]
+    DeserializationError err = deserializeCbor(
+        doc,
+        "\x82\xA2\x62id\x01\x61x\x02\xA2\x62id\x03\x61x\x04", 17,
+        DeserializationOption::Filter(filter));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "[{\"id\":1},{\"id\":3}]");
+  }
+}
@@ -0,0 +1,38 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+using namespace ARDUINOJSON_NAMESPACE;
+
+TEST_CASE("halfToFloat()") {
+  SECTION("zero") {
+    REQUIRE(halfToFloat(0x0000) == 0.0f);
+    REQUIRE(halfToFloat(0x8000) == 0.0f);
+  }
+
+  SECTION("normal") {
+    REQUIRE(halfToFloat(0x3C00) == 1.0f);
+    REQUIRE(halfToFloat(0x3555) == 0.333251953125f);
+    REQUIRE(halfToFloat(0xC000) == -2.0f);
+    REQUIRE(halfToFloat(0x7BFF) == 65504.0f);
+    REQUIRE(halfToFloat(0x0400) == 0.00006103515625f);
+  }
+
+  SECTION("subnormal") {
+    REQUIRE(halfToFloat(0x0001) == 0.000000059604644775390625f);
+    REQUIRE(halfToFloat(0x03FF) == 0.000060975551605224609375f);
+  }
+
+  SECTION("infinity") {
+    REQUIRE(halfToFloat(0x7C00) > 3.4e38f);
+    REQUIRE(halfToFloat(0xFC00) < -3.4e38f);
+  }
+
+  SECTION("NaN") {
+    float value = halfToFloat(0x7E00);
+    REQUIRE(value != value);
+  }
+}
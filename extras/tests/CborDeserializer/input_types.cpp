@@ -0,0 +1,93 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include "CustomReader.hpp"
+
+TEST_CASE("deserializeCbor(const std::string&)") {
+  DynamicJsonDocument doc(4096);
+
+  SECTION("should duplicate content") {
+    std::string input("\x81\x65hello");
+
+    DeserializationError err = deserializeCbor(doc, input);
+    input[2] = 'X';  // alter the string to make sure we made a copy
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc[0] == "hello");
+  }
+
+  SECTION("should accept a zero in input") {
+    DeserializationError err =
+        deserializeCbor(doc, std::string("\x82\x00\x02", 3));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "[0,2]");
+  }
+}
+
+TEST_CASE("deserializeCbor(std::istream&)") {
+  DynamicJsonDocument doc(4096);
+
+  SECTION("should accept a zero in input") {
+    std::istringstream input(std::string("\x82\x00\x02", 3));
+
+    DeserializationError err = deserializeCbor(doc, input);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "[0,2]");
+  }
+
+  SECTION("should detect incomplete input") {
+    std::istringstream input("\x82\x01");
+
+    DeserializationError err = deserializeCbor(doc, input);
+
+    REQUIRE(err == DeserializationError::IncompleteInput);
+  }
+}
+
+TEST_CASE("deserializeCbor(CustomReader)") {
+  DynamicJsonDocument doc(4096);
+  CustomReader reader("\xA1\x61\x61\x64IETF");
+
+  DeserializationError err = deserializeCbor(doc, reader);
+
+  REQUIRE(err == DeserializationError::Ok);
+  REQUIRE(doc["a"] == "IETF");
+}
+
+TEST_CASE("deserializeCbor(char*)") {
+  DynamicJsonDocument doc(4096);
+
+  SECTION("strings are stored in place") {
+    char input[] = "\xA1\x61\x61\x7F\x62IE\x62TF\xFF";
+
+    DeserializationError err = deserializeCbor(doc, input, sizeof(input) - 1);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc["a"] == "IETF");
+    REQUIRE(doc.memoryUsage() == JSON_OBJECT_SIZE(1));
+
+    const char* value = doc["a"];
+    REQUIRE(value >= input);
+    REQUIRE(value < input + sizeof(input));
+  }
+
+  SECTION("byte strings are stored in place") {
+    char input[] = "\x81\x43\x01\x00\x02";
+
+    DeserializationError err = deserializeCbor(doc, input, sizeof(input) - 1);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.memoryUsage() == JSON_ARRAY_SIZE(1));
+
+    MsgPackBinary bin = doc[0];
+    REQUIRE(bin.size() == 3);
+    REQUIRE(reinterpret_cast<const char*>(bin.data()) >= input);
+    REQUIRE(reinterpret_cast<const char*>(bin.data()) < input + sizeof(input));
+  }
+}
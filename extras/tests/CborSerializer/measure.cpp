@@ -0,0 +1,14 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+TEST_CASE("measureCbor()") {
+  DynamicJsonDocument doc(4096);
+  JsonObject object = doc.to<JsonObject>();
+  object["hello"] = "world";
+
+  REQUIRE(measureCbor(doc) == 13);
+}
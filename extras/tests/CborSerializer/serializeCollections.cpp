@@ -0,0 +1,71 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+static void check(const JsonDocument& doc, const std::string& expected) {
+  std::string actual;
+  size_t len = serializeCbor(doc, actual);
+  REQUIRE(len == expected.size());
+  REQUIRE(actual == expected);
+}
+
+TEST_CASE("serialize CBOR array") {
+  DynamicJsonDocument doc(4096);
+  JsonArray array = doc.to<JsonArray>();
+
+  SECTION("empty") {
+    check(doc, "\x80");
+  }
+
+  SECTION("[1,2,3]") {
+    array.add(1);
+    array.add(2);
+    array.add(3);
+    check(doc, "\x83\x01\x02\x03");
+  }
+
+  SECTION("25 elements") {
+    for (int i = 0; i < 25; i++) array.add(true);
+    check(doc, "\x98\x19" + std::string(25, '\xF5'));
+  }
+
+  SECTION("nested") {
+    array.add(1);
+    JsonArray nested = array.createNestedArray();
+    nested.add(2);
+    nested.add(3);
+    check(doc, "\x82\x01\x82\x02\x03");
+  }
+}
+
+TEST_CASE("serialize CBOR map") {
+  DynamicJsonDocument doc(4096);
+  JsonObject object = doc.to<JsonObject>();
+
+  SECTION("empty") {
+    check(doc, "\xA0");
+  }
+
+  SECTION("{\"a\":1,\"b\":[2,3]}") {
+    object["a"] = 1;
+    JsonArray b = object.createNestedArray("b");
+    b.add(2);
+    b.add(3);
+    check(doc, "\xA2\x61\x61\x01\x61\x62\x82\x02\x03");
+  }
+
+  SECTION("24 members") {
+    std::string expected = "\xB8\x18";
+    for (char c = 'a'; c < 'a' + 24; c++) {
+      char key[2] = {c, 0};
+      object[key] = static_cast<const char*>(0);
+      expected += '\x61';
+      expected += c;
+      expected += '\xF6';
+    }
+    check(doc, expected);
+  }
+}
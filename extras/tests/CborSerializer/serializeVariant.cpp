@@ -0,0 +1,115 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+template <typename T>
+static void checkVariant(T value, const char* expected_data,
+                         size_t expected_len) {
+  DynamicJsonDocument doc(expected_len + 4096);
+  JsonVariant variant = doc.to<JsonVariant>();
+  variant.set(value);
+  std::string expected(expected_data, expected_data + expected_len);
+  std::string actual;
+  size_t len = serializeCbor(variant, actual);
+  CAPTURE(variant);
+  REQUIRE(len == expected_len);
+  REQUIRE(actual == expected);
+}
+
+template <typename T, size_t N>
+static void checkVariant(T value, const char (&expected_data)[N]) {
+  const size_t expected_len = N - 1;
+  checkVariant(value, expected_data, expected_len);
+}
+
+template <typename T>
+static void checkVariant(T value, const std::string& expected) {
+  checkVariant(value, expected.data(), expected.length());
+}
+
+TEST_CASE("serialize CBOR value") {
+  SECTION("unbound") {
+    checkVariant(JsonVariant(), "\xF6");
+  }
+
+  SECTION("null") {
+    const char* nil = 0;
+    checkVariant(nil, "\xF6");
+  }
+
+  SECTION("bool") {
+    checkVariant(false, "\xF4");
+    checkVariant(true, "\xF5");
+  }
+
+  SECTION("unsigned integer") {
+    checkVariant(0, "\x00");
+    checkVariant(23, "\x17");
+    checkVariant(24, "\x18\x18");
+    checkVariant(255, "\x18\xFF");
+    checkVariant(256, "\x19\x01\x00");
+    checkVariant(65535, "\x19\xFF\xFF");
+    checkVariant(65536, "\x1A\x00\x01\x00\x00");
+    checkVariant(4294967295U, "\x1A\xFF\xFF\xFF\xFF");
+  }
+
+  SECTION("negative integer") {
+    checkVariant(-1, "\x20");
+    checkVariant(-24, "\x37");
+    checkVariant(-25, "\x38\x18");
+    checkVariant(-256, "\x38\xFF");
+    checkVariant(-257, "\x39\x01\x00");
+    checkVariant(-65537, "\x3A\x00\x01\x00\x00");
+  }
+
+#if ARDUINOJSON_USE_LONG_LONG
+  SECTION("64-bit integers") {
+    checkVariant(1000000000000LL, "\x1B\x00\x00\x00\xE8\xD4\xA5\x10\x00");
+    checkVariant(-4294967297LL, "\x3B\x00\x00\x00\x01\x00\x00\x00\x00");
+    checkVariant(18446744073709551615ULL,
+                 "\x1B\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF");
+  }
+#endif
+
+  SECTION("float") {
+    checkVariant(1.5, "\xFA\x3F\xC0\x00\x00");
+    checkVariant(-4.25f, "\xFA\xC0\x88\x00\x00");
+  }
+
+  SECTION("double") {
+    checkVariant(1.1, "\xFB\x3F\xF1\x99\x99\x99\x99\x99\x9A");
+  }
+
+  SECTION("float with an integral value") {
+    checkVariant(100000.0, "\x1A\x00\x01\x86\xA0");
+    checkVariant(-2.0f, "\x21");
+  }
+
+  SECTION("text string") {
+    checkVariant("", "\x60");
+    checkVariant("a", "\x61\x61");
+    checkVariant("IETF", "\x64IETF");
+    checkVariant(std::string(24, '?'), "\x78\x18" + std::string(24, '?'));
+    checkVariant(std::string(256, '?'),
+                 std::string("\x79\x01\x00", 3) + std::string(256, '?'));
+  }
+
+  SECTION("byte string") {
+    checkVariant(MsgPackBinary("\x01\x02\x03\x04", 4), "\x44\x01\x02\x03\x04");
+  }
+
+  SECTION("extension") {
+    checkVariant(MsgPackExtension(1, "\x02", 1),
+                 std::string("\xDA\x4D\x50\x00\x01\x41\x02", 7));
+    checkVariant(MsgPackExtension(-1, "", 0),
+                 std::string("\xDA\x4D\x50\x00\xFF\x40", 6));
+  }
+
+  SECTION("serialized(const char*)") {
+    checkVariant(serialized("\xF5"), "\xF5");
+    checkVariant(serialized("\x82\x01\x02"), "\x82\x01\x02");
+  }
+}
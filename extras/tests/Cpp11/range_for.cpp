@@ -0,0 +1,41 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+
+#include <catch.hpp>
+#include <sstream>
+
+TEST_CASE("range-based for") {
+  StaticJsonDocument<128> doc;
+
+  SECTION("streamJsonArray()") {
+    std::istringstream input("[{\"id\":1},{\"id\":2},{\"id\":3}]");
+    auto stream = streamJsonArray(doc, input);
+
+    int sum = 0;
+    for (JsonDocument& element : stream)
+      sum += element["id"].as<int>();
+
+    REQUIRE(sum == 6);
+    REQUIRE(stream.error() == DeserializationError::Ok);
+  }
+
+  SECTION("streamJsonObject()") {
+    std::istringstream input("{\"a\":1,\"b\":{\"x\":[]},\"c\":3}");
+    auto stream = streamJsonObject(doc, input);
+
+    std::string keys;
+    int sum = 0;
+    for (auto& member : stream) {
+      keys += member.key().c_str();
+      if (member.key() != "b")
+        sum += member.value().as<int>();
+    }
+
+    REQUIRE(keys == "abc");
+    REQUIRE(sum == 4);
+    REQUIRE(stream.error() == DeserializationError::Ok);
+  }
+}
@@ -0,0 +1,261 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#define ARDUINOJSON_ENABLE_SHARED_DOCUMENT 1
+#include <ArduinoJson.h>
+
+#include <stdlib.h>  // malloc, free
+#include <atomic>
+#include <catch.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+static std::atomic<int> liveBlocks(0);
+
+struct CountingAllocator {
+  void* allocate(size_t n) {
+    liveBlocks++;
+    return malloc(n);
+  }
+  void deallocate(void* p) {
+    liveBlocks--;
+    free(p);
+  }
+  void* reallocate(void* p, size_t n) {
+    return realloc(p, n);
+  }
+};
+
+typedef BasicJsonDocument<CountingAllocator> CountingDocument;
+typedef BasicSharedJsonDocument<CountingAllocator> CountingSharedDocument;
+typedef BasicJsonDocumentPublisher<CountingAllocator> CountingPublisher;
+
+static std::string toJson(JsonVariantConst var) {
+  std::string json;
+  serializeJson(var, json);
+  return json;
+}
+
+TEST_CASE("SharedJsonDocument") {
+  SECTION("is empty by default") {
+    SharedJsonDocument shared;
+
+    REQUIRE_FALSE(shared);
+    REQUIRE(JsonVariantConst(shared).isNull());
+  }
+
+  SECTION("takes the content of the document") {
+    DynamicJsonDocument doc(256);
+    deserializeJson(doc, "{\"hello\":\"world\"}");
+
+    SharedJsonDocument shared(doc);
+
+    REQUIRE(shared);
+    REQUIRE(toJson(*shared) == "{\"hello\":\"world\"}");
+    REQUIRE(shared->memoryUsage() == JSON_OBJECT_SIZE(1) + 12);
+    REQUIRE(doc.isNull());
+  }
+
+  SECTION("is freed with the last copy") {
+    {
+      CountingDocument doc(256);
+      doc["hello"] = "world";
+      CountingSharedDocument copy;
+      {
+        CountingSharedDocument shared(doc);
+        copy = shared;
+        REQUIRE(copy == shared);
+      }
+      REQUIRE(liveBlocks == 2);  // the node and the pool
+      REQUIRE(toJson(*copy) == "{\"hello\":\"world\"}");
+    }
+    REQUIRE(liveBlocks == 0);
+  }
+}
+
+TEST_CASE("linkMembers()") {
+  SECTION("links the keys and the values") {
+    DynamicJsonDocument doc(256);
+    deserializeJson(doc, "{\"a\":\"hello\",\"b\":[1,2]}");
+    SharedJsonDocument v1(doc);
+
+    DynamicJsonDocument next(256);
+    REQUIRE(linkMembers(next.to<JsonVariant>(), v1));
+    next["b"] = 3;
+    SharedJsonDocument v2(next, v1);
+
+    REQUIRE(toJson(*v2) == "{\"a\":\"hello\",\"b\":3}");
+    REQUIRE(toJson(*v1) == "{\"a\":\"hello\",\"b\":[1,2]}");
+    REQUIRE((*v2)["a"].as<const char*>() == (*v1)["a"].as<const char*>());
+    REQUIRE(v2->memoryUsage() == JSON_OBJECT_SIZE(2));
+  }
+
+  SECTION("returns false when the document is full") {
+    DynamicJsonDocument doc(256);
+    deserializeJson(doc, "{\"a\":1,\"b\":2}");
+    StaticJsonDocument<JSON_OBJECT_SIZE(1)> next;
+
+    REQUIRE_FALSE(linkMembers(next.to<JsonVariant>(), doc.as<JsonVariant>()));
+  }
+
+  SECTION("makes an empty object when the source isn't an object") {
+    DynamicJsonDocument next(256);
+
+    REQUIRE(linkMembers(next.to<JsonVariant>(), JsonVariantConst()));
+    REQUIRE(toJson(next.as<JsonVariant>()) == "{}");
+  }
+}
+
+TEST_CASE("SharedJsonDocument with a base") {
+  CountingDocument doc(256);
+  deserializeJson(doc, "{\"a\":\"hello\",\"b\":\"world\"}");
+  CountingSharedDocument v1(doc);
+  REQUIRE(liveBlocks == 2);  // the node and the pool of v1
+
+  SECTION("keeps the base alive when it links to it") {
+    CountingDocument next(256);
+    linkMembers(next.to<JsonVariant>(), v1);
+    next["b"] = "there";
+    CountingSharedDocument v2(next, v1);
+    v1 = CountingSharedDocument();
+
+    REQUIRE(liveBlocks == 5);  // v1, v2, and the list of the bases of v2
+    REQUIRE(toJson(*v2) == "{\"a\":\"hello\",\"b\":\"there\"}");
+
+    v2 = CountingSharedDocument();
+    REQUIRE(liveBlocks == 0);
+  }
+
+  SECTION("keeps the base alive when it links to its keys") {
+    CountingDocument next(256);
+    linkMembers(next.to<JsonVariant>(), v1);
+    next["a"] = "bye";
+    next["b"] = "now";
+    CountingSharedDocument v2(next, v1);
+    v1 = CountingSharedDocument();
+
+    REQUIRE(liveBlocks == 5);  // v1, v2, and the list of the bases of v2
+    REQUIRE(toJson(*v2) == "{\"a\":\"bye\",\"b\":\"now\"}");
+  }
+
+  SECTION("doesn't keep the base alive when it doesn't link to it") {
+    CountingDocument next(256);
+    next["a"] = "bye";
+    CountingSharedDocument v2(next, v1);
+    v1 = CountingSharedDocument();
+
+    REQUIRE(liveBlocks == 2);  // the node and the pool of v2
+    REQUIRE(toJson(*v2) == "{\"a\":\"bye\"}");
+  }
+
+  SECTION("links to the versions its base links to") {
+    CountingDocument next(256);
+    linkMembers(next.to<JsonVariant>(), v1);
+    next["b"] = "there";
+    CountingSharedDocument v2(next, v1);
+
+    CountingDocument last(256);
+    linkMembers(last.to<JsonVariant>(), v2);
+    last["b"] = "you";
+    CountingSharedDocument v3(last, v2);
+    v1 = CountingSharedDocument();
+    v2 = CountingSharedDocument();
+
+    // v2 is freed, but v1 still holds "hello"
+    REQUIRE(toJson(*v3) == "{\"a\":\"hello\",\"b\":\"you\"}");
+    REQUIRE(liveBlocks == 5);  // v1, v3, and the list of the bases of v3
+  }
+}
+
+TEST_CASE("JsonDocumentPublisher") {
+  DynamicJsonDocument doc(256);
+  doc["version"] = 1;
+  SharedJsonDocument v1(doc);
+
+  SECTION("load() returns an empty document by default") {
+    JsonDocumentPublisher publisher;
+
+    REQUIRE_FALSE(publisher.load());
+  }
+
+  SECTION("load() returns the published document") {
+    JsonDocumentPublisher publisher(v1);
+
+    REQUIRE(publisher.load() == v1);
+
+    DynamicJsonDocument next(256);
+    next["version"] = 2;
+    SharedJsonDocument v2(next);
+    publisher.publish(v2);
+
+    REQUIRE(publisher.load() == v2);
+    REQUIRE((*v1)["version"] == 1);
+  }
+
+  SECTION("exchange() returns the previous document") {
+    JsonDocumentPublisher publisher(v1);
+
+    SharedJsonDocument previous = publisher.exchange(SharedJsonDocument());
+
+    REQUIRE(previous == v1);
+    REQUIRE_FALSE(publisher.load());
+  }
+
+  SECTION("frees the document it holds") {
+    {
+      CountingDocument counting(256);
+      counting["version"] = 1;
+      CountingPublisher publisher{CountingSharedDocument(counting)};
+    }
+    REQUIRE(liveBlocks == 0);
+  }
+}
+
+// Run this test with -fsanitize=thread to check the synchronization
+TEST_CASE("JsonDocumentPublisher stress test") {
+  const int versions = 2000;
+  const int readerCount = 4;
+
+  DynamicJsonDocument doc(256);
+  doc["version"] = 0;
+  doc["constant"] = std::string("shared by all versions");
+  doc["copy"] = 0;
+  SharedJsonDocument first(doc);
+  JsonDocumentPublisher publisher(first);
+
+  std::atomic<bool> done(false);
+  std::atomic<int> errors(0);
+  std::vector<std::thread> readers;
+  for (int i = 0; i < readerCount; i++) {
+    readers.emplace_back([&]() {
+      int last = 0;
+      while (!done) {
+        SharedJsonDocument snapshot = publisher.load();
+        int version = (*snapshot)["version"];
+        if (version < last || (*snapshot)["copy"] != version ||
+            (*snapshot)["constant"] != "shared by all versions")
+          errors++;
+        last = version;
+      }
+    });
+  }
+
+  for (int i = 1; i <= versions; i++) {
+    SharedJsonDocument current = publisher.load();
+    DynamicJsonDocument next(256);
+    linkMembers(next.to<JsonVariant>(), current);
+    next["version"] = i;
+    next["copy"] = i;
+    publisher.publish(SharedJsonDocument(next, current));
+  }
+  done = true;
+  for (size_t i = 0; i < readers.size(); i++) readers[i].join();
+
+  SharedJsonDocument last = publisher.load();
+  REQUIRE(errors == 0);
+  REQUIRE((*last)["version"] == versions);
+  REQUIRE((*last)["constant"].as<const char*>() ==
+          (*first)["constant"].as<const char*>());
+}
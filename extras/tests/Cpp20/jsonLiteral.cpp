@@ -0,0 +1,109 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+
+#include <catch.hpp>
+#include <string>
+
+using ARDUINOJSON_NAMESPACE::JsonLiteralString;
+using ARDUINOJSON_NAMESPACE::parseNumber;
+
+// Checks that the literal gives the same document as deserializeJson()
+template <JsonLiteralString json>
+static void checkLiteral() {
+  CAPTURE(json.chars);
+  DynamicJsonDocument doc(4096);
+  REQUIRE(deserializeJson(doc, json.chars) == DeserializationError::Ok);
+  std::string expected;
+  serializeJson(doc, expected);
+
+  JsonVariantConst literal = jsonLiteral<json>();
+  std::string actual;
+  serializeJson(literal, actual);
+
+  REQUIRE(actual == expected);
+  REQUIRE(literal == doc.as<JsonVariantConst>());
+}
+
+TEST_CASE("jsonLiteral()") {
+  SECTION("object") {
+    JsonVariantConst config =
+        jsonLiteral<R"({"host":"example.com","port":80,"tls":false})">();
+
+    REQUIRE(config.is<JsonObjectConst>());
+    REQUIRE(config.size() == 3);
+    REQUIRE(config["host"] == "example.com");
+    REQUIRE(config["port"] == 80);
+    REQUIRE(config["tls"] == false);
+  }
+
+  SECTION("returns the same image every time") {
+    JsonVariantConst a = jsonLiteral<"[\"hello\"]">();
+    JsonVariantConst b = jsonLiteral<"[\"hello\"]">();
+
+    REQUIRE(a[0].as<const char*>() == b[0].as<const char*>());
+  }
+
+  SECTION("the image can be viewed with viewImage()") {
+    const auto& image = jsonLiteralImage<R"({"a":[1,"b"]})">;
+    JsonVariantConst view;
+
+    DeserializationError err = viewImage(view, image.bytes, sizeof(image));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(view["a"][1] == "b");
+  }
+
+  SECTION("scalars") {
+    checkLiteral<"null">();
+    checkLiteral<"true">();
+    checkLiteral<"false">();
+    checkLiteral<"\"hello\"">();
+    checkLiteral<"''">();
+  }
+
+  SECTION("integers") {
+    checkLiteral<"[0,42,-42,+7]">();
+    checkLiteral<"[9223372036854775807,-9223372036854775808]">();
+    checkLiteral<"[18446744073709551615,18446744073709551616]">();
+    checkLiteral<"-9223372036854775809">();
+
+    REQUIRE(jsonLiteral<"-42">().as<long>() == -42);
+    REQUIRE(jsonLiteral<"18446744073709551615">().as<unsigned long long>() ==
+            18446744073709551615ULL);
+  }
+
+  SECTION("floats") {
+    checkLiteral<"[0.5,-1.25,3.14159,1e3,1E-3,.5,-0.0,0.0]">();
+    checkLiteral<"[1e300,-1e300,1e-300,1.7976931348623157e308]">();
+    checkLiteral<"[4.9e-324,2.2250738585072014e-308,1e-320]">();
+    checkLiteral<"[1e400,-1e400,1e-400]">();
+    checkLiteral<"123456789012345678901234567890">();
+
+    REQUIRE(jsonLiteral<"3.14159">().as<double>() ==
+            parseNumber<double>("3.14159"));
+    REQUIRE(jsonLiteral<"1e-300">().as<double>() ==
+            parseNumber<double>("1e-300"));
+  }
+
+  SECTION("strings") {
+    checkLiteral<R"(["\"\\\/\b\f\n\r\t"])">();
+    checkLiteral<R"(["café","€","😀"])">();
+    checkLiteral<R"(["\u00e9\u20AC\ud83d\ude00"])">();
+
+    REQUIRE(jsonLiteral<R"("a\nb")">() == "a\nb");
+  }
+
+  SECTION("nesting") {
+    checkLiteral<R"({"a":{"b":[[],{},[{"c":[1,[2,[3]]]}]]},"d":null})">();
+    checkLiteral<"[]">();
+    checkLiteral<"{}">();
+  }
+
+  SECTION("relaxed syntax, like deserializeJson()") {
+    checkLiteral<" { 'a' : 1 ,\n\tb_2 : [ 'x' , \"y\" ] } ">();
+    checkLiteral<"{key:-1}">();
+  }
+}
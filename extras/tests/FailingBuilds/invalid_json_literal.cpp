@@ -0,0 +1,10 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+
+// See jsonLiteral.hpp
+int main() {
+  jsonLiteral<"{\"a\":1,\"a\":2}">();
+}
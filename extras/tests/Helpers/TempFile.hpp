@@ -0,0 +1,45 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <stdlib.h>  // getenv, mkstemp
+#include <unistd.h>  // close, unlink, write
+#include <string>
+
+// A file in $TMPDIR that is deleted when the object is destroyed.
+// Without TMPDIR, the file goes in the working directory, which is the build
+// directory when the tests run with ctest.
+class TempFile {
+ public:
+  TempFile(const char* content, size_t size) {
+    const char* dir = getenv("TMPDIR");
+    _path = dir && *dir ? dir : ".";
+    _path += "/ArduinoJsonXXXXXX";
+    _fd = mkstemp(&_path[0]);
+    if (_fd >= 0 &&
+        write(_fd, content, size) != static_cast<ssize_t>(size)) {
+      close(_fd);
+      _fd = -1;
+    }
+  }
+
+  ~TempFile() {
+    if (_fd >= 0)
+      close(_fd);
+    unlink(_path.c_str());
+  }
+
+  const char* path() const {
+    return _path.c_str();
+  }
+
+  int fd() const {
+    return _fd;
+  }
+
+ private:
+  std::string _path;
+  int _fd;
+};
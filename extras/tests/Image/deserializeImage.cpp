@@ -0,0 +1,144 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string.h>  // memcpy, memset
+#include <string>
+
+static const char* json =
+    "{\"name\":\"gateway\",\"ports\":[80,443],\"tls\":{\"enabled\":true,"
+    "\"ratio\":0.5},\"raw\":null}";
+
+TEST_CASE("deserializeImage()") {
+  DynamicJsonDocument src(4096);
+  deserializeJson(src, json);
+  void* image[256];  // aligned
+  size_t imageSize = serializeImage(src, image, sizeof(image));
+  REQUIRE(imageSize > 0);
+
+  SECTION("same capacity") {
+    DynamicJsonDocument doc(4096);
+
+    DeserializationError err = deserializeImage(doc, image, imageSize);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc == src);
+    REQUIRE(doc.memoryUsage() == src.memoryUsage());
+  }
+
+  SECTION("smaller capacity") {
+    DynamicJsonDocument doc(src.memoryUsage());
+
+    DeserializationError err = deserializeImage(doc, image, imageSize);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc == src);
+  }
+
+  SECTION("insufficient capacity") {
+    DynamicJsonDocument doc(src.memoryUsage() - 1);
+
+    DeserializationError err = deserializeImage(doc, image, imageSize);
+
+    REQUIRE(err == DeserializationError::NoMemory);
+    REQUIRE(doc.isNull());
+  }
+
+  SECTION("image was moved") {
+    void* copy[256];
+    memcpy(copy, image, imageSize);
+    memset(image, '#', imageSize);
+    DynamicJsonDocument doc(4096);
+
+    DeserializationError err = deserializeImage(doc, copy, imageSize);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc == src);
+  }
+
+  SECTION("document can be modified") {
+    DynamicJsonDocument doc(4096);
+    deserializeImage(doc, image, imageSize);
+
+    doc["ports"].add(8080);
+    doc["raw"] = serialized(std::string("[1]"));
+    doc[std::string("name")] = std::string("gateway");  // deduplicated
+
+    std::string output;
+    serializeJson(doc, output);
+    REQUIRE(output ==
+            "{\"name\":\"gateway\",\"ports\":[80,443,8080],\"tls\":{"
+            "\"enabled\":true,\"ratio\":0.5},\"raw\":[1]}");
+  }
+
+  SECTION("empty input") {
+    DynamicJsonDocument doc(4096);
+
+    REQUIRE(deserializeImage(doc, image, 0) ==
+            DeserializationError::EmptyInput);
+    REQUIRE(deserializeImage(doc, 0, imageSize) ==
+            DeserializationError::EmptyInput);
+  }
+
+  SECTION("truncated image") {
+    DynamicJsonDocument doc(4096);
+
+    REQUIRE(deserializeImage(doc, image, imageSize - 1) ==
+            DeserializationError::IncompleteInput);
+    REQUIRE(deserializeImage(doc, image, 8) ==
+            DeserializationError::IncompleteInput);
+  }
+
+  SECTION("not an image") {
+    DynamicJsonDocument doc(4096);
+    reinterpret_cast<char*>(image)[0] = '{';
+
+    REQUIRE(deserializeImage(doc, image, imageSize) ==
+            DeserializationError::InvalidInput);
+  }
+
+  SECTION("nesting limit") {
+    DynamicJsonDocument doc(4096);
+
+    REQUIRE(deserializeImage(doc, image, imageSize,
+                             DeserializationOption::NestingLimit(1)) ==
+            DeserializationError::TooDeep);
+    REQUIRE(deserializeImage(doc, image, imageSize,
+                             DeserializationOption::NestingLimit(2)) ==
+            DeserializationError::Ok);
+  }
+
+  SECTION("corrupted image") {
+    // Every byte is altered in turn: the reference that goes out of the image
+    // must be rejected, the other changes must be harmless
+    DynamicJsonDocument doc(4096);
+    for (size_t i = 0; i < imageSize; i++) {
+      void* copy[256];
+      memcpy(copy, image, imageSize);
+      reinterpret_cast<unsigned char*>(copy)[i] ^= 0x55;
+
+      DeserializationError err = deserializeImage(doc, copy, imageSize);
+
+      std::string output;
+      serializeJson(doc, output);
+      CAPTURE(i);
+      REQUIRE((err == DeserializationError::Ok ||
+               err == DeserializationError::InvalidInput ||
+               err == DeserializationError::IncompleteInput ||
+               err == DeserializationError::NoMemory));
+      if (err)
+        REQUIRE(doc.isNull());
+    }
+  }
+
+  SECTION("other ABI") {
+    DynamicJsonDocument doc(4096);
+    reinterpret_cast<char*>(image)[4]++;  // version number
+
+    REQUIRE(deserializeImage(doc, image, imageSize) ==
+            DeserializationError::InvalidInput);
+  }
+}
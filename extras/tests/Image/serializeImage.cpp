@@ -0,0 +1,91 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string.h>  // memcmp, memset
+#include <string>
+
+using ARDUINOJSON_NAMESPACE::addPadding;
+using ARDUINOJSON_NAMESPACE::ImageHeader;
+
+TEST_CASE("serializeImage()") {
+  DynamicJsonDocument doc(4096);
+  void* buffer[1024];  // aligned
+
+  SECTION("empty document") {
+    size_t n = serializeImage(doc, buffer, sizeof(buffer));
+
+    REQUIRE(n == sizeof(ImageHeader));
+    REQUIRE(measureImage(doc) == n);
+  }
+
+  SECTION("size is header + strings + variants") {
+    deserializeJson(doc, "{\"hello\":\"world\"}");
+
+    size_t n = serializeImage(doc, buffer, sizeof(buffer));
+
+    REQUIRE(n == addPadding(sizeof(ImageHeader) + 12) + JSON_OBJECT_SIZE(1));
+    REQUIRE(measureImage(doc) == n);
+  }
+
+  SECTION("rejects linked strings") {
+    doc["hello"] = "world";
+
+    REQUIRE(measureImage(doc) == 0);
+    REQUIRE(serializeImage(doc, buffer, sizeof(buffer)) == 0);
+  }
+
+  SECTION("rejects linked keys") {
+    doc["hello"] = std::string("world");
+
+    REQUIRE(measureImage(doc) == 0);
+  }
+
+  SECTION("rejects linked raw values") {
+    doc.add(serialized("[1,2]"));
+
+    REQUIRE(measureImage(doc) == 0);
+  }
+
+  SECTION("rejects linked variants") {
+    StaticJsonDocument<128> doc2;
+    doc2.set(42);
+    doc.addElement().link(doc2);
+
+    REQUIRE(measureImage(doc) == 0);
+  }
+
+  SECTION("accepts owned strings") {
+    doc[std::string("hello")] = std::string("world");
+    doc[std::string("raw")] = serialized(std::string("[1,2]"));
+
+    REQUIRE(measureImage(doc) != 0);
+  }
+
+  SECTION("doesn't depend on the content of the buffer") {
+    deserializeJson(doc, "{\"hello\":\"world\"}");
+    void* other[1024];
+    memset(buffer, 0xAA, sizeof(buffer));
+    memset(other, 0x55, sizeof(other));
+
+    size_t n = serializeImage(doc, buffer, sizeof(buffer));
+    serializeImage(doc, other, sizeof(other));
+
+    REQUIRE(memcmp(buffer, other, n) == 0);
+  }
+
+  SECTION("buffer too small") {
+    deserializeJson(doc, "[1,2,3]");
+
+    REQUIRE(serializeImage(doc, buffer, measureImage(doc) - 1) == 0);
+  }
+
+  SECTION("misaligned buffer") {
+    char* misaligned = reinterpret_cast<char*>(buffer) + 1;
+
+    REQUIRE(serializeImage(doc, misaligned, sizeof(buffer) - 1) == 0);
+  }
+}
@@ -0,0 +1,59 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string.h>  // memcpy, memset
+#include <string>
+
+TEST_CASE("viewImage()") {
+  DynamicJsonDocument src(4096);
+  deserializeJson(src, "{\"hello\":[\"world\",42]}");
+  void* image[128];  // aligned
+  size_t imageSize = serializeImage(src, image, sizeof(image));
+  REQUIRE(imageSize > 0);
+
+  SECTION("gives access to the image") {
+    JsonVariantConst variant;
+
+    DeserializationError err = viewImage(variant, image, imageSize);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(variant == src.as<JsonVariantConst>());
+    REQUIRE(variant["hello"][0] == "world");
+  }
+
+  SECTION("doesn't copy the image") {
+    JsonVariantConst variant;
+
+    viewImage(variant, image, imageSize);
+
+    const char* world = variant["hello"][0];
+    REQUIRE(world > reinterpret_cast<char*>(image));
+    REQUIRE(world < reinterpret_cast<char*>(image) + imageSize);
+  }
+
+  SECTION("image was moved") {
+    void* copy[128];
+    memcpy(copy, image, imageSize);
+    memset(image, '#', imageSize);
+    JsonVariantConst variant;
+
+    viewImage(variant, copy, imageSize);
+
+    std::string json;
+    serializeJson(variant, json);
+    REQUIRE(json == "{\"hello\":[\"world\",42]}");
+  }
+
+  SECTION("invalid image") {
+    JsonVariantConst variant = src.as<JsonVariantConst>();
+
+    DeserializationError err = viewImage(variant, image, imageSize - 1);
+
+    REQUIRE(err == DeserializationError::IncompleteInput);
+    REQUIRE(variant.isNull());
+  }
+}
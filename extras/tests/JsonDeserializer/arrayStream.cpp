@@ -0,0 +1,149 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <sstream>
+#include <string>
+
+typedef JsonArrayStream<ARDUINOJSON_NAMESPACE::Reader<std::istringstream>,
+                        ARDUINOJSON_NAMESPACE::AllowAllFilter>
+    StdStreamArrayStream;
+
+TEST_CASE("streamJsonArray()") {
+  StaticJsonDocument<128> doc;
+
+  SECTION("yields each element") {
+    std::istringstream input(
+        "[{\"id\":1,\"name\":\"first\"}, {\"id\":2,\"name\":\"second\"}]");
+    StdStreamArrayStream stream = streamJsonArray(doc, input);
+
+    REQUIRE(stream.next() == true);
+    REQUIRE(doc["id"] == 1);
+    REQUIRE(doc["name"] == "first");
+
+    REQUIRE(stream.next() == true);
+    REQUIRE(doc["id"] == 2);
+    REQUIRE(doc["name"] == "second");
+
+    REQUIRE(stream.next() == false);
+    REQUIRE(stream.error() == DeserializationError::Ok);
+    REQUIRE(stream.next() == false);
+  }
+
+  SECTION("the document only needs to fit one element") {
+    std::string input = "[";
+    for (int i = 0; i < 100; i++)
+      input += "{\"value\":\"a string that is copied\"},";
+    input += "{\"value\":\"last\"}]";
+
+    JsonArrayStream<ARDUINOJSON_NAMESPACE::Reader<std::string>,
+                    ARDUINOJSON_NAMESPACE::AllowAllFilter>
+        stream = streamJsonArray(doc, input);
+
+    int count = 0;
+    while (stream.next())
+      count++;
+
+    REQUIRE(stream.error() == DeserializationError::Ok);
+    REQUIRE(count == 101);
+  }
+
+  SECTION("doesn't read past the element") {
+    std::istringstream input("[{},{}]");
+    StdStreamArrayStream stream = streamJsonArray(doc, input);
+
+    REQUIRE(stream.next() == true);
+    REQUIRE(input.peek() == ',');
+  }
+
+  SECTION("empty array") {
+    std::istringstream input(" [ ] ");
+    StdStreamArrayStream stream = streamJsonArray(doc, input);
+
+    REQUIRE(stream.next() == false);
+    REQUIRE(stream.error() == DeserializationError::Ok);
+  }
+
+  SECTION("applies the filter to each element") {
+    StaticJsonDocument<32> filter;
+    filter["id"] = true;
+    std::istringstream input("[{\"id\":1,\"name\":\"first\"}]");
+
+    JsonArrayStream<ARDUINOJSON_NAMESPACE::Reader<std::istringstream>,
+                    DeserializationOption::Filter>
+        stream = streamJsonArray(doc, input,
+                                 DeserializationOption::Filter(filter));
+
+    REQUIRE(stream.next() == true);
+    REQUIRE(doc.as<std::string>() == "{\"id\":1}");
+  }
+
+  SECTION("the nesting limit includes the array") {
+    std::istringstream input("[[1],[2]]");
+    StdStreamArrayStream stream =
+        streamJsonArray(doc, input, DeserializationOption::NestingLimit(1));
+
+    REQUIRE(stream.next() == false);
+    REQUIRE(stream.error() == DeserializationError::TooDeep);
+  }
+
+  SECTION("EmptyInput") {
+    std::istringstream input("  ");
+    StdStreamArrayStream stream = streamJsonArray(doc, input);
+
+    REQUIRE(stream.next() == false);
+    REQUIRE(stream.error() == DeserializationError::EmptyInput);
+  }
+
+  SECTION("IncompleteInput") {
+    std::istringstream input("[1,");
+    StdStreamArrayStream stream = streamJsonArray(doc, input);
+
+    REQUIRE(stream.next() == true);
+    REQUIRE(stream.next() == false);
+    REQUIRE(stream.error() == DeserializationError::IncompleteInput);
+  }
+
+  SECTION("InvalidInput") {
+    SECTION("not an array") {
+      std::istringstream input("{}");
+      StdStreamArrayStream stream = streamJsonArray(doc, input);
+
+      REQUIRE(stream.next() == false);
+      REQUIRE(stream.error() == DeserializationError::InvalidInput);
+    }
+
+    SECTION("missing comma") {
+      std::istringstream input("[1 2]");
+      StdStreamArrayStream stream = streamJsonArray(doc, input);
+
+      REQUIRE(stream.next() == true);
+      REQUIRE(stream.next() == false);
+      REQUIRE(stream.error() == DeserializationError::InvalidInput);
+    }
+  }
+
+  SECTION("NoMemory") {
+    std::istringstream input("[[1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17]]");
+    StdStreamArrayStream stream = streamJsonArray(doc, input);
+
+    REQUIRE(stream.next() == false);
+    REQUIRE(stream.error() == DeserializationError::NoMemory);
+  }
+
+  SECTION("char* and size") {
+    char input[] = "[1,2,3]";
+
+    JsonArrayStream<ARDUINOJSON_NAMESPACE::BoundedReader<char*>,
+                    ARDUINOJSON_NAMESPACE::AllowAllFilter>
+        stream = streamJsonArray(doc, input, 3);
+
+    REQUIRE(stream.next() == true);
+    REQUIRE(doc.as<int>() == 1);
+    REQUIRE(stream.next() == false);
+    REQUIRE(stream.error() == DeserializationError::IncompleteInput);
+  }
+}
@@ -2,6 +2,9 @@
 // Copyright © 2014-2022, Benoit BLANCHON
 // MIT License
 
+#if defined(__unix__) || defined(__APPLE__)
+#  define ARDUINOJSON_ENABLE_MMAP 1  // MappedFile is opt-in
+#endif
 #include <ArduinoJson.h>
 
 #include <catch.hpp>
@@ -9,6 +12,10 @@
 
 #include "CustomReader.hpp"
 
+#if ARDUINOJSON_ENABLE_MMAP
+#  include "TempFile.hpp"
+#endif
+
 TEST_CASE("deserializeJson(char*)") {
   StaticJsonDocument<1024> doc;
 
@@ -117,6 +124,35 @@ TEST_CASE("deserializeJson(std::istream&)") {
 
     REQUIRE('1' == char(json.get()));
   }
+
+  SECTION("Should leave the stream in a good state") {
+    std::istringstream json("[1,2]");
+
+    deserializeJson(doc, json);
+
+    REQUIRE(json.good());
+  }
+
+  SECTION("Should set eofbit and failbit at the end of the input") {
+    std::istringstream json("[1,2");
+
+    DeserializationError err = deserializeJson(doc, json);
+
+    REQUIRE(err == DeserializationError::IncompleteInput);
+    REQUIRE(json.eof());
+    REQUIRE(json.fail());
+  }
+
+  SECTION("Should not read a stream in a failed state") {
+    std::istringstream json("[1,2]");
+    json.setstate(std::ios::failbit);
+
+    DeserializationError err = deserializeJson(doc, json);
+
+    REQUIRE(err == DeserializationError::EmptyInput);
+    json.clear();
+    REQUIRE('[' == char(json.get()));
+  }
 }
 
 #ifdef HAS_VARIABLE_LENGTH_ARRAY
@@ -143,6 +179,66 @@ TEST_CASE("deserializeJson(CustomReader)") {
   REQUIRE(doc[1] == 2);
 }
 
+#if ARDUINOJSON_ENABLE_MMAP
+TEST_CASE("deserializeJson(MappedFile)") {
+  DynamicJsonDocument doc(4096);
+  TempFile tmp("{\"hello\":\"world\"}", 17);
+
+  SECTION("from path") {
+    MappedFile file(tmp.path());
+
+    DeserializationError err = deserializeJson(doc, file);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc["hello"] == "world");
+  }
+
+  SECTION("from file descriptor") {
+    MappedFile file(tmp.fd());
+
+    DeserializationError err = deserializeJson(doc, file);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc["hello"] == "world");
+  }
+
+  SECTION("should duplicate content") {
+    MappedFile file(tmp.path());
+    deserializeJson(doc, file);
+
+    const char* hello = doc["hello"];
+    REQUIRE((hello < file.data() || hello >= file.data() + file.size()));
+  }
+
+  SECTION("file doesn't exist") {
+    MappedFile file("/this/file/does/not/exist");
+
+    DeserializationError err = deserializeJson(doc, file);
+
+    REQUIRE_FALSE(file);
+    REQUIRE(err == DeserializationError::EmptyInput);
+  }
+
+  SECTION("empty file") {
+    TempFile empty("", 0);
+    MappedFile file(empty.path());
+
+    DeserializationError err = deserializeJson(doc, file);
+
+    REQUIRE(err == DeserializationError::EmptyInput);
+  }
+
+  SECTION("incomplete input") {
+    TempFile incomplete("{\"hello\":", 9);
+    MappedFile file(incomplete.path());
+
+    DeserializationError err = deserializeJson(doc, file);
+
+    REQUIRE(err == DeserializationError::IncompleteInput);
+  }
+}
+#endif
+
 TEST_CASE("deserializeJson(JsonDocument&, MemberProxy)") {
   DynamicJsonDocument doc1(4096);
   doc1["payload"] = "[4,2]";
@@ -0,0 +1,171 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <sstream>
+#include <string>
+
+typedef JsonObjectStream<ARDUINOJSON_NAMESPACE::Reader<std::istringstream>,
+                         ARDUINOJSON_NAMESPACE::AllowAllFilter>
+    StdStreamObjectStream;
+
+TEST_CASE("streamJsonObject()") {
+  StaticJsonDocument<128> doc;
+
+  SECTION("yields each member") {
+    std::istringstream input(
+        "{\"dev1\":{\"temp\":21},\"dev2\":{\"temp\":22},\"dev3\":[1,2]}");
+    StdStreamObjectStream stream = streamJsonObject(doc, input);
+
+    REQUIRE(stream.next() == true);
+    REQUIRE(stream.key() == "dev1");
+    REQUIRE(stream.value()["temp"] == 21);
+
+    REQUIRE(stream.next() == true);
+    REQUIRE(stream.key() == "dev2");
+    REQUIRE(stream.value()["temp"] == 22);
+
+    REQUIRE(stream.next() == true);
+    REQUIRE(stream.key() == "dev3");
+    REQUIRE(stream.value().as<std::string>() == "[1,2]");
+
+    REQUIRE(stream.next() == false);
+    REQUIRE(stream.error() == DeserializationError::Ok);
+  }
+
+  SECTION("skips the values that are not read") {
+    std::istringstream input(
+        "{\"a\":{\"big\":[1,2,3,{\"x\":\"y\"}]},\"b\":2,\"c\":\"3\"}");
+    StdStreamObjectStream stream = streamJsonObject(doc, input);
+
+    REQUIRE(stream.next() == true);
+    REQUIRE(stream.key() == "a");
+    REQUIRE(stream.next() == true);
+    REQUIRE(stream.key() == "b");
+    REQUIRE(stream.next() == true);
+    REQUIRE(stream.key() == "c");
+    REQUIRE(stream.value() == "3");
+    REQUIRE(stream.next() == false);
+    REQUIRE(stream.error() == DeserializationError::Ok);
+  }
+
+  SECTION("value() can be called several times") {
+    std::istringstream input("{\"a\":1}");
+    StdStreamObjectStream stream = streamJsonObject(doc, input);
+
+    REQUIRE(stream.next() == true);
+    REQUIRE(stream.value() == 1);
+    REQUIRE(stream.value() == 1);
+  }
+
+  SECTION("the document only needs to fit one member") {
+    std::string input = "{";
+    for (int i = 0; i < 100; i++)
+      input += "\"key\":{\"value\":\"a string that is copied\"},";
+    input += "\"last\":0}";
+
+    JsonObjectStream<ARDUINOJSON_NAMESPACE::Reader<std::string>,
+                     ARDUINOJSON_NAMESPACE::AllowAllFilter>
+        stream = streamJsonObject(doc, input);
+
+    int count = 0;
+    while (stream.next()) {
+      stream.value();
+      count++;
+    }
+
+    REQUIRE(stream.error() == DeserializationError::Ok);
+    REQUIRE(count == 101);
+  }
+
+  SECTION("keeps duplicate keys") {
+    std::istringstream input("{\"a\":1,\"a\":2}");
+    StdStreamObjectStream stream = streamJsonObject(doc, input);
+
+    REQUIRE(stream.next() == true);
+    REQUIRE(stream.value() == 1);
+    REQUIRE(stream.next() == true);
+    REQUIRE(stream.key() == "a");
+    REQUIRE(stream.value() == 2);
+  }
+
+  SECTION("empty object") {
+    std::istringstream input(" { } ");
+    StdStreamObjectStream stream = streamJsonObject(doc, input);
+
+    REQUIRE(stream.next() == false);
+    REQUIRE(stream.error() == DeserializationError::Ok);
+  }
+
+  SECTION("applies the filter to the members") {
+    StaticJsonDocument<64> filter;
+    filter["*"]["temp"] = true;
+    std::istringstream input("{\"dev1\":{\"temp\":21,\"hum\":40}}");
+
+    JsonObjectStream<ARDUINOJSON_NAMESPACE::Reader<std::istringstream>,
+                     DeserializationOption::Filter>
+        stream = streamJsonObject(doc, input,
+                                  DeserializationOption::Filter(filter));
+
+    REQUIRE(stream.next() == true);
+    REQUIRE(stream.value().as<std::string>() == "{\"temp\":21}");
+  }
+
+  SECTION("the nesting limit includes the object") {
+    std::istringstream input("{\"a\":{\"b\":1}}");
+    StdStreamObjectStream stream =
+        streamJsonObject(doc, input, DeserializationOption::NestingLimit(1));
+
+    REQUIRE(stream.next() == true);
+    stream.value();
+    REQUIRE(stream.error() == DeserializationError::TooDeep);
+    REQUIRE(stream.next() == false);
+  }
+
+  SECTION("EmptyInput") {
+    std::istringstream input("  ");
+    StdStreamObjectStream stream = streamJsonObject(doc, input);
+
+    REQUIRE(stream.next() == false);
+    REQUIRE(stream.error() == DeserializationError::EmptyInput);
+  }
+
+  SECTION("IncompleteInput") {
+    std::istringstream input("{\"a\":1,\"b\"");
+    StdStreamObjectStream stream = streamJsonObject(doc, input);
+
+    REQUIRE(stream.next() == true);
+    REQUIRE(stream.next() == false);
+    REQUIRE(stream.error() == DeserializationError::IncompleteInput);
+  }
+
+  SECTION("InvalidInput") {
+    SECTION("not an object") {
+      std::istringstream input("[]");
+      StdStreamObjectStream stream = streamJsonObject(doc, input);
+
+      REQUIRE(stream.next() == false);
+      REQUIRE(stream.error() == DeserializationError::InvalidInput);
+    }
+
+    SECTION("missing colon") {
+      std::istringstream input("{\"a\" 1}");
+      StdStreamObjectStream stream = streamJsonObject(doc, input);
+
+      REQUIRE(stream.next() == false);
+      REQUIRE(stream.error() == DeserializationError::InvalidInput);
+    }
+  }
+
+  SECTION("NoMemory") {
+    std::istringstream input("{\"a\":[1,2,3,4,5,6,7,8,9,10,11,12,13,14,15]}");
+    StdStreamObjectStream stream = streamJsonObject(doc, input);
+
+    REQUIRE(stream.next() == true);
+    stream.value();
+    REQUIRE(stream.error() == DeserializationError::NoMemory);
+  }
+}
@@ -0,0 +1,156 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <stdio.h>
+
+#include <string>
+
+TEST_CASE("reparseJson()") {
+  DynamicJsonDocument doc(1024);
+
+  SECTION("first call is a full parse") {
+    DeserializationError err = reparseJson(doc, "{\"a\":[1,2],\"b\":\"x\"}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc["a"][1] == 2);
+    REQUIRE(doc["b"] == "x");
+  }
+
+  SECTION("same structure: overwrites the values in place") {
+    reparseJson(doc, "{\"id\":1,\"temp\":20.5,\"ok\":true,\"tags\":[1,null]}");
+    size_t memoryUsage = doc.memoryUsage();
+    const char* key = doc.as<JsonObject>().begin()->key().c_str();
+
+    DeserializationError err = reparseJson(
+        doc, "{\"id\":2, \"temp\":-3,\"ok\":null,\"tags\":[\"x\",false]}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc["id"] == 2);
+    REQUIRE(doc["temp"] == -3);
+    REQUIRE(doc["ok"].isNull());
+    REQUIRE(doc["tags"][0] == "x");
+    REQUIRE(doc["tags"][1] == false);
+    REQUIRE(doc.as<JsonObject>().begin()->key().c_str() == key);
+    REQUIRE(doc.memoryUsage() == memoryUsage + 2);  // only "x" was added
+  }
+
+  SECTION("unchanged strings are not copied again") {
+    reparseJson(doc, "{\"status\":\"running\",\"count\":1}");
+    size_t memoryUsage = doc.memoryUsage();
+
+    for (int i = 2; i < 1000; i++) {
+      char json[64];
+      sprintf(json, "{\"status\":\"running\",\"count\":%d}", i);
+      REQUIRE(reparseJson(doc, json) == DeserializationError::Ok);
+    }
+
+    REQUIRE(doc["count"] == 999);
+    REQUIRE(doc.memoryUsage() == memoryUsage);
+  }
+
+  SECTION("different structure: full parse") {
+    reparseJson(doc, "{\"a\":1,\"b\":[1,2]}");
+
+    SECTION("different key") {
+      REQUIRE(reparseJson(doc, "{\"a\":1,\"c\":[1,2]}") ==
+              DeserializationError::Ok);
+      REQUIRE(doc["c"][1] == 2);
+      REQUIRE(doc.containsKey("b") == false);
+    }
+
+    SECTION("different order") {
+      REQUIRE(reparseJson(doc, "{\"b\":[3],\"a\":2}") ==
+              DeserializationError::Ok);
+      REQUIRE(doc["a"] == 2);
+      REQUIRE(doc["b"].size() == 1);
+    }
+
+    SECTION("missing member") {
+      REQUIRE(reparseJson(doc, "{\"a\":2}") == DeserializationError::Ok);
+      REQUIRE(doc.size() == 1);
+    }
+
+    SECTION("extra member") {
+      REQUIRE(reparseJson(doc, "{\"a\":2,\"b\":[],\"c\":3}") ==
+              DeserializationError::Ok);
+      REQUIRE(doc["b"].size() == 0);
+      REQUIRE(doc["c"] == 3);
+    }
+
+    SECTION("more elements") {
+      REQUIRE(reparseJson(doc, "{\"a\":2,\"b\":[1,2,3]}") ==
+              DeserializationError::Ok);
+      REQUIRE(doc["b"][2] == 3);
+    }
+
+    SECTION("array instead of a value") {
+      REQUIRE(reparseJson(doc, "{\"a\":[2],\"b\":[1,2]}") ==
+              DeserializationError::Ok);
+      REQUIRE(doc["a"][0] == 2);
+    }
+
+    SECTION("value instead of an array") {
+      REQUIRE(reparseJson(doc, "{\"a\":1,\"b\":\"x\"}") ==
+              DeserializationError::Ok);
+      REQUIRE(doc["b"] == "x");
+    }
+
+    SECTION("not an object") {
+      REQUIRE(reparseJson(doc, "42") == DeserializationError::Ok);
+      REQUIRE(doc.as<int>() == 42);
+    }
+  }
+
+  SECTION("keys linked to the input are not trusted") {
+    char input[] = "{\"a\":1}";
+    deserializeJson(doc, input);  // zero-copy
+    input[2] = 'b';
+
+    REQUIRE(reparseJson(doc, "{\"b\":2}") == DeserializationError::Ok);
+    REQUIRE(doc["b"] == 2);
+    REQUIRE(doc.as<JsonObject>().begin()->key().c_str() != input + 2);
+  }
+
+  SECTION("errors are the same as deserializeJson()") {
+    reparseJson(doc, "{\"a\":1}");
+
+    REQUIRE(reparseJson(doc, "{\"a\":2") ==
+            DeserializationError::IncompleteInput);
+    REQUIRE(reparseJson(doc, "{\"a\":2}x") == DeserializationError::Ok);
+    REQUIRE(reparseJson(doc, "{\"a\";2}") ==
+            DeserializationError::InvalidInput);
+    REQUIRE(reparseJson(doc, "{\"a\":{}}",
+                        DeserializationOption::NestingLimit(1)) ==
+            DeserializationError::TooDeep);
+    REQUIRE(reparseJson(doc, "1 2") == DeserializationError::InvalidInput);
+  }
+
+  SECTION("falls back to a full parse when the pool is full") {
+    StaticJsonDocument<JSON_OBJECT_SIZE(1) + 8> small;
+    REQUIRE(reparseJson(small, "{\"s\":\"abc\"}") == DeserializationError::Ok);
+
+    REQUIRE(reparseJson(small, "{\"s\":\"def\"}") == DeserializationError::Ok);
+    REQUIRE(reparseJson(small, "{\"s\":\"ghi\"}") == DeserializationError::Ok);
+
+    REQUIRE(small["s"] == "ghi");
+  }
+
+  SECTION("std::string") {
+    REQUIRE(reparseJson(doc, std::string("[1]")) == DeserializationError::Ok);
+    REQUIRE(reparseJson(doc, std::string("[2]")) == DeserializationError::Ok);
+    REQUIRE(doc[0] == 2);
+  }
+
+  SECTION("char* and size") {
+    reparseJson(doc, "[1]");
+
+    REQUIRE(reparseJson(doc, "[2]", 2) ==
+            DeserializationError::IncompleteInput);
+    REQUIRE(reparseJson(doc, "[3]", 3) == DeserializationError::Ok);
+    REQUIRE(doc[0] == 3);
+  }
+}
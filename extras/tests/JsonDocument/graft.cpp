@@ -0,0 +1,200 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <stdlib.h>  // malloc, free
+#include <catch.hpp>
+#include <sstream>
+#include <string>
+
+class GraftSpyingAllocator {
+ public:
+  GraftSpyingAllocator(const GraftSpyingAllocator& src) : _log(src._log) {}
+  GraftSpyingAllocator(std::ostream& log) : _log(log) {}
+
+  void* allocate(size_t n) {
+    _log << "A";
+    return malloc(n);
+  }
+  void deallocate(void* p) {
+    _log << "F";
+    free(p);
+  }
+
+ private:
+  GraftSpyingAllocator& operator=(const GraftSpyingAllocator& src);
+
+  std::ostream& _log;
+};
+
+typedef BasicJsonDocument<GraftSpyingAllocator> SpyingDocument;
+
+// The number of allocations minus the number of frees
+static long liveAllocations(const std::stringstream& log) {
+  std::string s = log.str();
+  long n = 0;
+  for (size_t i = 0; i < s.size(); i++) n += s[i] == 'A' ? 1 : -1;
+  return n;
+}
+
+static std::string toJson(const JsonDocument& doc) {
+  std::string json;
+  serializeJson(doc, json);
+  return json;
+}
+
+TEST_CASE("BasicJsonDocument::graft()") {
+  std::stringstream log;
+
+  SECTION("attaches the content without copying it") {
+    {
+      SpyingDocument doc(4096, log);
+      SpyingDocument piece(1024, log);
+      deserializeJson(doc, "{\"id\":1}");
+      deserializeJson(piece, "{\"name\":\"hello\",\"values\":[1,2]}");
+      size_t memoryUsage = doc.memoryUsage();
+
+      REQUIRE(doc.graft(doc["piece"].to<JsonVariant>(), piece));
+
+      REQUIRE(toJson(doc) ==
+              "{\"id\":1,\"piece\":{\"name\":\"hello\",\"values\":[1,2]}}");
+      REQUIRE(doc.memoryUsage() == memoryUsage + JSON_OBJECT_SIZE(1));
+      REQUIRE(doc["piece"]["values"][1] == 2);
+
+      // the source is empty, with a new pool
+      REQUIRE(piece.isNull());
+      REQUIRE(piece.capacity() == 1024);
+      REQUIRE(piece.memoryUsage() == 0);
+    }
+    // doc, piece, node, piece, then free doc, node, grafted pool, piece
+    REQUIRE(log.str() == "AAAAFFFF");
+  }
+
+  SECTION("the source can be reused") {
+    SpyingDocument doc(4096, log);
+    SpyingDocument piece(1024, log);
+    JsonArray array = doc.to<JsonArray>();
+
+    for (int i = 0; i < 3; i++) {
+      piece["i"] = i;
+      REQUIRE(doc.graft(array.addElement(), piece));
+    }
+
+    REQUIRE(toJson(doc) == "[{\"i\":0},{\"i\":1},{\"i\":2}]");
+  }
+
+  SECTION("the root") {
+    SpyingDocument doc(4096, log);
+    SpyingDocument piece(1024, log);
+    piece.set(std::string("hello"));
+
+    REQUIRE(doc.graft(doc, piece));
+
+    REQUIRE(doc.as<std::string>() == "hello");
+  }
+
+  SECTION("the pools grafted to the source come along") {
+    SpyingDocument doc(4096, log);
+    SpyingDocument piece(1024, log);
+    SpyingDocument subpiece(1024, log);
+    deserializeJson(subpiece, "[1,2,3]");
+    REQUIRE(piece.graft(piece["sub"].to<JsonVariant>(), subpiece));
+
+    REQUIRE(doc.graft(doc["piece"].to<JsonVariant>(), piece));
+
+    REQUIRE(toJson(doc) == "{\"piece\":{\"sub\":[1,2,3]}}");
+  }
+
+  SECTION("target doesn't belong to the document") {
+    SpyingDocument doc(4096, log);
+    SpyingDocument other(4096, log);
+    SpyingDocument piece(1024, log);
+    piece["hello"] = "world";
+
+    REQUIRE_FALSE(doc.graft(other["a"].to<JsonVariant>(), piece));
+    REQUIRE_FALSE(doc.graft(JsonVariant(), piece));
+    REQUIRE_FALSE(doc.graft(doc, doc));
+    REQUIRE(piece["hello"] == "world");
+  }
+
+  SECTION("a copy copies the grafted values") {
+    SpyingDocument* doc = new SpyingDocument(JSON_OBJECT_SIZE(1), log);
+    SpyingDocument piece(1024, log);
+    deserializeJson(piece, "{\"name\":\"hello\"}");
+    doc->graft((*doc)["piece"].to<JsonVariant>(), piece);
+
+    SpyingDocument copy(*doc);
+    delete doc;
+
+    REQUIRE(toJson(copy) == "{\"piece\":{\"name\":\"hello\"}}");
+    REQUIRE_FALSE(copy.overflowed());
+  }
+
+  SECTION("garbageCollect() copies the grafted values") {
+    SpyingDocument doc(1024, log);
+    SpyingDocument piece(1024, log);
+    deserializeJson(piece, "{\"name\":\"hello\"}");
+    doc.graft(doc["piece"].to<JsonVariant>(), piece);
+
+    REQUIRE(doc.garbageCollect());
+
+    REQUIRE(toJson(doc) == "{\"piece\":{\"name\":\"hello\"}}");
+  }
+
+#if ARDUINOJSON_HAS_RVALUE_REFERENCES
+  SECTION("a move keeps the grafted pools") {
+    SpyingDocument doc(1024, log);
+    SpyingDocument piece(1024, log);
+    deserializeJson(piece, "{\"name\":\"hello\"}");
+    doc.graft(doc["piece"].to<JsonVariant>(), piece);
+
+    SpyingDocument moved(std::move(doc));
+
+    REQUIRE(toJson(moved) == "{\"piece\":{\"name\":\"hello\"}}");
+  }
+#endif
+
+  SECTION("clear() frees the grafted pools") {
+    SpyingDocument doc(1024, log);
+    {
+      SpyingDocument piece(1024, log);
+      doc.graft(doc, piece);
+    }
+    log.str("");
+
+    doc.clear();
+
+    REQUIRE(log.str() == "FF");
+  }
+
+  SECTION("deserializeJson() frees the grafted pools") {
+    SpyingDocument doc(1024, log);
+    SpyingDocument piece(1024, log);
+    log.str("");
+
+    for (int i = 0; i < 5; i++) {
+      deserializeJson(doc, "{\"id\":1}");
+      deserializeJson(piece, "[1,2]");
+      REQUIRE(doc.graft(doc["piece"].to<JsonVariant>(), piece));
+    }
+    deserializeJson(doc, "{\"id\":2}");
+
+    // each graft allocates a node and a new pool for piece, and the next
+    // deserializeJson() frees the node and the grafted pool
+    REQUIRE(liveAllocations(log) == 0);
+    REQUIRE(toJson(doc) == "{\"id\":2}");
+  }
+
+  SECTION("to<T>() frees the grafted pools") {
+    SpyingDocument doc(1024, log);
+    SpyingDocument piece(1024, log);
+    piece["hello"] = "world";
+    doc.graft(doc, piece);
+    log.str("");
+
+    doc.to<JsonObject>();
+
+    REQUIRE(log.str() == "FF");
+  }
+}
@@ -0,0 +1,119 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string>
+
+static const char* const keys[] = {"humidity", "id", "temperature", "unit"};
+
+TEST_CASE("JsonKeyDictionary") {
+  JsonKeyDictionary dictionary(keys);
+
+  SECTION("find()") {
+    REQUIRE(dictionary.size() == 4);
+    REQUIRE(dictionary.find("humidity") == keys[0]);
+    REQUIRE(dictionary.find("id") == keys[1]);
+    REQUIRE(dictionary.find("temperature") == keys[2]);
+    REQUIRE(dictionary.find("unit") == keys[3]);
+    REQUIRE(dictionary.find("units", 4) == keys[3]);
+    REQUIRE(dictionary.find("i") == 0);
+    REQUIRE(dictionary.find("units") == 0);
+    REQUIRE(dictionary.find("") == 0);
+    REQUIRE(dictionary.find(static_cast<const char*>(0)) == 0);
+  }
+
+  SECTION("isSorted()") {
+    static const char* const unsorted[] = {"b", "a"};
+    static const char* const duplicates[] = {"a", "a"};
+
+    REQUIRE(dictionary.isSorted() == true);
+    REQUIRE(JsonKeyDictionary::isSorted(keys, 4) == true);
+    REQUIRE(JsonKeyDictionary::isSorted(unsorted, 2) == false);
+    REQUIRE(JsonKeyDictionary::isSorted(duplicates, 2) == false);
+    REQUIRE(JsonKeyDictionary(keys, 0).find("id") == 0);
+  }
+}
+
+TEST_CASE("JsonDocument::setKeyDictionary()") {
+  JsonKeyDictionary dictionary(keys);
+  DynamicJsonDocument doc(1024);
+  doc.setKeyDictionary(&dictionary);
+
+  SECTION("deserializeJson() links the keys of the dictionary") {
+    deserializeJson(doc, "{\"id\":1,\"temperature\":20,\"other\":3}");
+
+    JsonObject::iterator it = doc.as<JsonObject>().begin();
+    REQUIRE(it->key().c_str() == keys[1]);
+    ++it;
+    REQUIRE(it->key().c_str() == keys[2]);
+    ++it;
+    REQUIRE(it->key() == "other");
+    REQUIRE(doc.memoryUsage() == JSON_OBJECT_SIZE(3) + JSON_STRING_SIZE(5));
+  }
+
+  SECTION("nested objects") {
+    deserializeJson(doc, "[{\"unit\":\"C\"},{\"unit\":\"F\"}]");
+
+    REQUIRE(doc[0].as<JsonObject>().begin()->key().c_str() == keys[3]);
+    REQUIRE(doc[1].as<JsonObject>().begin()->key().c_str() == keys[3]);
+    REQUIRE(doc[1]["unit"] == "F");
+  }
+
+  SECTION("string values are still copied") {
+    deserializeJson(doc, "{\"unit\":\"id\"}");
+
+    REQUIRE(doc["unit"].as<const char*>() != keys[1]);
+  }
+
+  SECTION("deserializeMsgPack()") {
+    deserializeMsgPack(doc, "\x81\xA2id\x01");
+
+    REQUIRE(doc.as<JsonObject>().begin()->key().c_str() == keys[1]);
+    REQUIRE(doc["id"] == 1);
+  }
+
+  SECTION("lookup with the entry of the dictionary") {
+    deserializeJson(doc, "{\"id\":1,\"temperature\":20}");
+
+    REQUIRE(doc[keys[2]] == 20);
+    REQUIRE(doc["temperature"] == 20);
+    REQUIRE(doc.containsKey(keys[0]) == false);
+  }
+
+  SECTION("survives garbageCollect()") {
+    doc.garbageCollect();
+    deserializeJson(doc, "{\"id\":1}");
+
+    REQUIRE(doc.as<JsonObject>().begin()->key().c_str() == keys[1]);
+  }
+
+  SECTION("reparseJson() trusts the keys of the dictionary") {
+    reparseJson(doc, "{\"id\":1,\"unit\":\"C\"}");
+    size_t memoryUsage = doc.memoryUsage();
+
+    REQUIRE(reparseJson(doc, "{\"id\":2,\"unit\":\"C\"}") ==
+            DeserializationError::Ok);
+
+    REQUIRE(doc["id"] == 2);
+    REQUIRE(doc.memoryUsage() == memoryUsage);
+  }
+
+  SECTION("zero-copy mode is unchanged") {
+    char input[] = "{\"id\":1}";
+    deserializeJson(doc, input);
+
+    const char* key = doc.as<JsonObject>().begin()->key().c_str();
+    REQUIRE(key >= input);
+    REQUIRE(key < input + sizeof(input));
+  }
+
+  SECTION("null removes the dictionary") {
+    doc.setKeyDictionary(0);
+    deserializeJson(doc, "{\"id\":1}");
+
+    REQUIRE(doc.as<JsonObject>().begin()->key().c_str() != keys[1]);
+  }
+}
@@ -51,6 +51,25 @@ TEST_CASE("JsonObject::operator==()") {
     REQUIRE(obj1c == obj2c);
   }
 
+  SECTION("should return true when nested objs are in different order") {
+    deserializeJson(doc1, "{\"a\":{\"x\":1,\"y\":[2]},\"b\":3}");
+    deserializeJson(doc2, "{\"b\":3,\"a\":{\"y\":[2],\"x\":1}}");
+    obj1c = doc1.as<JsonObjectConst>();
+    obj2c = doc2.as<JsonObjectConst>();
+
+    REQUIRE(obj1c == obj2c);
+    REQUIRE(obj1c.hash() == obj2c.hash());
+  }
+
+  SECTION("should return false when a key is duplicated") {
+    deserializeJson(doc1, "{\"a\":1,\"b\":2}");
+    deserializeJson(doc2, "{\"a\":1,\"a\":1}");
+    obj1c = doc1.as<JsonObjectConst>();
+    obj2c = doc2.as<JsonObjectConst>();
+
+    REQUIRE_FALSE(obj1c == obj2c);
+  }
+
   SECTION("should return false when RHS is null") {
     JsonObject null;
 
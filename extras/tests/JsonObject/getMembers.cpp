@@ -0,0 +1,132 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string>
+
+TEST_CASE("JsonObject::getMembers()") {
+  DynamicJsonDocument doc(4096);
+  deserializeJson(doc, "{\"id\":1,\"ts\":2,\"value\":3,\"unit\":\"C\"}");
+  JsonObject obj = doc.as<JsonObject>();
+
+  SECTION("keys in the same order as the members") {
+    const char* const keys[] = {"id", "ts", "value", "unit"};
+    JsonVariant values[4];
+
+    REQUIRE(obj.getMembers(keys, values) == 4);
+    REQUIRE(values[0] == 1);
+    REQUIRE(values[1] == 2);
+    REQUIRE(values[2] == 3);
+    REQUIRE(values[3] == "C");
+  }
+
+  SECTION("keys in a different order") {
+    const char* const keys[] = {"unit", "ts", "id", "value"};
+    JsonVariant values[4];
+
+    REQUIRE(obj.getMembers(keys, values) == 4);
+    REQUIRE(values[0] == "C");
+    REQUIRE(values[1] == 2);
+    REQUIRE(values[2] == 1);
+    REQUIRE(values[3] == 3);
+  }
+
+  SECTION("missing keys") {
+    const char* const keys[] = {"id", "missing", "unit", "ts"};
+    JsonVariant values[4];
+
+    REQUIRE(obj.getMembers(keys, values) == 3);
+    REQUIRE(values[0] == 1);
+    REQUIRE(values[1].isUnbound());
+    REQUIRE(values[2] == "C");
+    REQUIRE(values[3] == 2);
+  }
+
+  SECTION("same key twice") {
+    const char* const keys[] = {"ts", "ts"};
+    JsonVariant values[2];
+
+    REQUIRE(obj.getMembers(keys, values) == 2);
+    REQUIRE(values[0] == 2);
+    REQUIRE(values[1] == 2);
+  }
+
+  SECTION("values are writable") {
+    const char* const keys[] = {"value"};
+    JsonVariant values[1];
+    obj.getMembers(keys, values);
+
+    values[0].set(42);
+
+    REQUIRE(obj["value"] == 42);
+  }
+
+  SECTION("pointer and size") {
+    std::string keys[] = {"value", "id"};
+    JsonVariant values[2];
+
+    REQUIRE(obj.getMembers(keys, values, 1) == 1);
+    REQUIRE(values[0] == 3);
+    REQUIRE(values[1].isUnbound());
+  }
+
+  SECTION("JsonKey") {
+    static const JsonKey keys[] = {JsonKey("ts"), JsonKey("unit")};
+    JsonVariant values[2];
+
+    REQUIRE(obj.getMembers(keys, values) == 2);
+    REQUIRE(values[0] == 2);
+    REQUIRE(values[1] == "C");
+  }
+
+  SECTION("empty object") {
+    const char* const keys[] = {"id"};
+    JsonVariant values[1];
+
+    REQUIRE(doc.to<JsonObject>().getMembers(keys, values) == 0);
+    REQUIRE(values[0].isUnbound());
+  }
+
+  SECTION("null object") {
+    const char* const keys[] = {"id"};
+    JsonVariant values[1];
+
+    REQUIRE(JsonObject().getMembers(keys, values) == 0);
+    REQUIRE(values[0].isUnbound());
+  }
+}
+
+TEST_CASE("JsonObjectConst::getMembers()") {
+  DynamicJsonDocument doc(4096);
+  deserializeJson(doc, "{\"id\":1,\"ts\":2,\"value\":3}");
+  JsonObjectConst obj = doc.as<JsonObjectConst>();
+
+  SECTION("keys in the same order as the members") {
+    const char* const keys[] = {"id", "value"};
+    JsonVariantConst values[2];
+
+    REQUIRE(obj.getMembers(keys, values) == 2);
+    REQUIRE(values[0] == 1);
+    REQUIRE(values[1] == 3);
+  }
+
+  SECTION("keys in a different order, with a missing key") {
+    const char* const keys[] = {"value", "missing", "id"};
+    JsonVariantConst values[3];
+
+    REQUIRE(obj.getMembers(keys, values) == 2);
+    REQUIRE(values[0] == 3);
+    REQUIRE(values[1].isUnbound());
+    REQUIRE(values[2] == 1);
+  }
+
+  SECTION("null object") {
+    const char* const keys[] = {"id"};
+    JsonVariantConst values[1];
+
+    REQUIRE(JsonObjectConst().getMembers(keys, values) == 0);
+  }
+}
@@ -0,0 +1,82 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+using ARDUINOJSON_NAMESPACE::adaptString;
+using ARDUINOJSON_NAMESPACE::stringHash;
+
+TEST_CASE("JsonKey") {
+  DynamicJsonDocument doc(4096);
+  JsonObject obj = doc.to<JsonObject>();
+  obj["hello"] = "world";
+  obj["a"] = 1;
+  obj["iz"] = 2;  // same hash as "a"
+
+  SECTION("size() and hash()") {
+    JsonKey key("hello");
+
+    REQUIRE(key.size() == 5);
+    REQUIRE(key.hash() == stringHash(adaptString("hello")));
+    REQUIRE(JsonKey("hello world", 5).hash() == key.hash());
+  }
+
+  SECTION("operator[]") {
+    REQUIRE(obj[JsonKey("hello")] == "world");
+    REQUIRE(obj[JsonKey("hello world", 5)] == "world");
+    REQUIRE(obj[JsonKey("hell")].isNull());
+  }
+
+  SECTION("same hash, different keys") {
+    REQUIRE(JsonKey("a").hash() == JsonKey("iz").hash());
+    REQUIRE(obj[JsonKey("a")] == 1);
+    REQUIRE(obj[JsonKey("iz")] == 2);
+    REQUIRE(obj["iz"] == 2);
+  }
+
+  SECTION("containsKey()") {
+    REQUIRE(obj.containsKey(JsonKey("hello")) == true);
+    REQUIRE(obj.containsKey(JsonKey("world")) == false);
+  }
+
+  SECTION("remove()") {
+    obj.remove(JsonKey("a"));
+
+    REQUIRE(obj.size() == 2);
+    REQUIRE(obj["iz"] == 2);
+  }
+
+  SECTION("adding a member copies the key") {
+    char name[] = "world";
+    obj[JsonKey(name)] = 3;
+    name[0] = 'W';
+
+    REQUIRE(obj["world"] == 3);
+    REQUIRE(obj[JsonKey("world")] == 3);
+  }
+
+  SECTION("JsonKeyDictionary") {
+    static const char* const keys[] = {"humidity", "temperature"};
+    JsonKeyDictionary dictionary(keys);
+    doc.setKeyDictionary(&dictionary);
+    deserializeJson(doc, "{\"temperature\":20}");
+
+    REQUIRE(doc[JsonKey(keys[1])] == 20);
+    REQUIRE(doc[JsonKey("temperature")] == 20);
+    REQUIRE(doc[JsonKey(keys[1], 4)].isNull());
+  }
+
+  SECTION("keys set in other ways") {
+    deserializeJson(doc, "{\"hello\":1}");
+    REQUIRE(doc[JsonKey("hello")] == 1);
+
+    deserializeMsgPack(doc, "\x81\xA5hello\x02");
+    REQUIRE(doc[JsonKey("hello")] == 2);
+
+    doc.clear();
+    doc[std::string("hello")] = 3;
+    REQUIRE(doc[JsonKey("hello")] == 3);
+  }
+}
@@ -0,0 +1,227 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string>
+
+static std::string patchJson(const char* input, const char* patch,
+                             DeserializationError expected =
+                                 DeserializationError::Ok) {
+  DynamicJsonDocument doc(4096);
+  DynamicJsonDocument patchDoc(4096);
+  REQUIRE(deserializeJson(doc, input) == DeserializationError::Ok);
+  REQUIRE(deserializeJson(patchDoc, patch) == DeserializationError::Ok);
+  REQUIRE(applyJsonPatch(doc, patchDoc.as<JsonVariantConst>()) == expected);
+  std::string output;
+  serializeJson(doc, output);
+  return output;
+}
+
+TEST_CASE("applyJsonPatch()") {
+  SECTION("empty patch") {
+    REQUIRE(patchJson("{\"a\":1}", "[]") == "{\"a\":1}");
+  }
+
+  SECTION("add a member") {
+    REQUIRE(patchJson("{\"a\":1}",
+                      "[{\"op\":\"add\",\"path\":\"/b\",\"value\":[2]}]") ==
+            "{\"a\":1,\"b\":[2]}");
+  }
+
+  SECTION("add replaces an existing member") {
+    REQUIRE(patchJson("{\"a\":1}",
+                      "[{\"op\":\"add\",\"path\":\"/a\",\"value\":2}]") ==
+            "{\"a\":2}");
+  }
+
+  SECTION("add an element in the middle") {
+    REQUIRE(patchJson("[1,3]",
+                      "[{\"op\":\"add\",\"path\":\"/1\",\"value\":2}]") ==
+            "[1,2,3]");
+  }
+
+  SECTION("add an element at the beginning") {
+    REQUIRE(patchJson("[2,3]",
+                      "[{\"op\":\"add\",\"path\":\"/0\",\"value\":1}]") ==
+            "[1,2,3]");
+  }
+
+  SECTION("add an element at the end") {
+    REQUIRE(patchJson("[1,2]",
+                      "[{\"op\":\"add\",\"path\":\"/-\",\"value\":3},"
+                      "{\"op\":\"add\",\"path\":\"/3\",\"value\":4}]") ==
+            "[1,2,3,4]");
+  }
+
+  SECTION("add an element after the end") {
+    REQUIRE(patchJson("[1]", "[{\"op\":\"add\",\"path\":\"/2\",\"value\":3}]",
+                      DeserializationError::InvalidInput) == "[1]");
+  }
+
+  SECTION("add to a missing parent") {
+    REQUIRE(patchJson("{}", "[{\"op\":\"add\",\"path\":\"/a/b\",\"value\":1}]",
+                      DeserializationError::InvalidInput) == "{}");
+  }
+
+  SECTION("add the whole document") {
+    REQUIRE(patchJson("{\"a\":1}",
+                      "[{\"op\":\"add\",\"path\":\"\",\"value\":[1]}]") ==
+            "[1]");
+  }
+
+  SECTION("remove a member") {
+    REQUIRE(patchJson("{\"a\":1,\"b\":{\"c\":2,\"d\":3}}",
+                      "[{\"op\":\"remove\",\"path\":\"/b/c\"}]") ==
+            "{\"a\":1,\"b\":{\"d\":3}}");
+  }
+
+  SECTION("remove an element") {
+    REQUIRE(patchJson("[1,2,3]", "[{\"op\":\"remove\",\"path\":\"/1\"}]") ==
+            "[1,3]");
+  }
+
+  SECTION("remove a missing member") {
+    REQUIRE(patchJson("{\"a\":1}", "[{\"op\":\"remove\",\"path\":\"/b\"}]",
+                      DeserializationError::InvalidInput) == "{\"a\":1}");
+  }
+
+  SECTION("replace a value") {
+    REQUIRE(patchJson("{\"a\":[1,2]}",
+                      "[{\"op\":\"replace\",\"path\":\"/a/1\",\"value\":3}]") ==
+            "{\"a\":[1,3]}");
+  }
+
+  SECTION("replace a missing value") {
+    REQUIRE(patchJson("{}",
+                      "[{\"op\":\"replace\",\"path\":\"/a\",\"value\":3}]",
+                      DeserializationError::InvalidInput) == "{}");
+  }
+
+  SECTION("move a member") {
+    REQUIRE(patchJson("{\"a\":{\"b\":\"hello\"},\"c\":{}}",
+                      "[{\"op\":\"move\",\"from\":\"/a/b\","
+                      "\"path\":\"/c/d\"}]") ==
+            "{\"a\":{},\"c\":{\"d\":\"hello\"}}");
+  }
+
+  SECTION("move an element in the same array") {
+    REQUIRE(patchJson("[1,2,3,4]",
+                      "[{\"op\":\"move\",\"from\":\"/1\",\"path\":\"/3\"}]") ==
+            "[1,3,4,2]");
+  }
+
+  SECTION("move a value to its parent") {
+    REQUIRE(patchJson("{\"a\":{\"b\":[1]}}",
+                      "[{\"op\":\"move\",\"from\":\"/a/b\","
+                      "\"path\":\"/a\"}]") ==
+            "{\"a\":[1]}");
+  }
+
+  SECTION("move a value inside itself") {
+    REQUIRE(patchJson("{\"a\":{}}",
+                      "[{\"op\":\"move\",\"from\":\"/a\",\"path\":\"/a/b\"}]",
+                      DeserializationError::InvalidInput) == "{\"a\":{}}");
+  }
+
+  SECTION("move shares the strings") {
+    DynamicJsonDocument doc(4096);
+    DynamicJsonDocument patch(4096);
+    deserializeJson(doc, "{\"a\":\"hello\"}");
+    deserializeJson(patch,
+                    "[{\"op\":\"move\",\"from\":\"/a\",\"path\":\"/b\"}]");
+    size_t before = doc.memoryUsage();
+
+    REQUIRE(applyJsonPatch(doc, patch.as<JsonVariantConst>()) ==
+            DeserializationError::Ok);
+
+    REQUIRE(doc["b"] == "hello");
+    REQUIRE(doc.memoryUsage() == before + JSON_OBJECT_SIZE(1) + 2);
+  }
+
+  SECTION("copy a value") {
+    REQUIRE(patchJson("{\"a\":[1,{\"b\":2}]}",
+                      "[{\"op\":\"copy\",\"from\":\"/a\",\"path\":\"/c\"}]") ==
+            "{\"a\":[1,{\"b\":2}],\"c\":[1,{\"b\":2}]}");
+  }
+
+  SECTION("copy a value inside itself") {
+    REQUIRE(patchJson("{\"a\":{\"b\":1}}",
+                      "[{\"op\":\"copy\",\"from\":\"/a\","
+                      "\"path\":\"/a/c\"}]") ==
+            "{\"a\":{\"b\":1,\"c\":{\"b\":1}}}");
+  }
+
+  SECTION("test succeeds") {
+    REQUIRE(patchJson("{\"a\":[1,{\"b\":\"c\"}]}",
+                      "[{\"op\":\"test\",\"path\":\"/a\","
+                      "\"value\":[1.0,{\"b\":\"c\"}]}]") ==
+            "{\"a\":[1,{\"b\":\"c\"}]}");
+  }
+
+  SECTION("test fails") {
+    patchJson("{\"a\":1}", "[{\"op\":\"test\",\"path\":\"/a\",\"value\":2}]",
+              DeserializationError::InvalidInput);
+  }
+
+  SECTION("test doesn't confuse true and 1") {
+    patchJson("{\"a\":1}",
+              "[{\"op\":\"test\",\"path\":\"/a\",\"value\":true}]",
+              DeserializationError::InvalidInput);
+  }
+
+  SECTION("escaped tokens") {
+    REQUIRE(patchJson("{\"a/b\":1,\"c~d\":2}",
+                      "[{\"op\":\"replace\",\"path\":\"/a~1b\",\"value\":3},"
+                      "{\"op\":\"remove\",\"path\":\"/c~0d\"},"
+                      "{\"op\":\"add\",\"path\":\"/e~1~0\",\"value\":4}]") ==
+            "{\"a/b\":3,\"e/~\":4}");
+  }
+
+  SECTION("invalid escape sequence") {
+    patchJson("{\"a~2\":1}", "[{\"op\":\"remove\",\"path\":\"/a~2\"}]",
+              DeserializationError::InvalidInput);
+  }
+
+  SECTION("invalid index") {
+    patchJson("[1,2]", "[{\"op\":\"remove\",\"path\":\"/01\"}]",
+              DeserializationError::InvalidInput);
+  }
+
+  SECTION("invalid path") {
+    patchJson("{\"a\":1}", "[{\"op\":\"remove\",\"path\":\"a\"}]",
+              DeserializationError::InvalidInput);
+  }
+
+  SECTION("unknown operation") {
+    patchJson("{}", "[{\"op\":\"merge\",\"path\":\"\"}]",
+              DeserializationError::InvalidInput);
+  }
+
+  SECTION("patch is not an array") {
+    patchJson("{}", "{\"op\":\"remove\",\"path\":\"\"}",
+              DeserializationError::InvalidInput);
+  }
+
+  SECTION("stops at the first failure") {
+    REQUIRE(patchJson("{\"a\":1}",
+                      "[{\"op\":\"add\",\"path\":\"/b\",\"value\":2},"
+                      "{\"op\":\"test\",\"path\":\"/a\",\"value\":0},"
+                      "{\"op\":\"add\",\"path\":\"/c\",\"value\":3}]",
+                      DeserializationError::InvalidInput) ==
+            "{\"a\":1,\"b\":2}");
+  }
+
+  SECTION("document too small") {
+    StaticJsonDocument<JSON_OBJECT_SIZE(1)> doc;
+    DynamicJsonDocument patch(4096);
+    deserializeJson(doc, "{\"a\":1}");
+    deserializeJson(patch,
+                    "[{\"op\":\"add\",\"path\":\"/b\",\"value\":[1,2,3]}]");
+
+    REQUIRE(applyJsonPatch(doc, patch.as<JsonVariantConst>()) ==
+            DeserializationError::NoMemory);
+  }
+}
@@ -0,0 +1,104 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string>
+
+static std::string diff(const char* source, const char* target) {
+  DynamicJsonDocument sourceDoc(4096);
+  DynamicJsonDocument targetDoc(4096);
+  DynamicJsonDocument patch(4096);
+  REQUIRE(deserializeJson(sourceDoc, source) == DeserializationError::Ok);
+  REQUIRE(deserializeJson(targetDoc, target) == DeserializationError::Ok);
+
+  REQUIRE(diffJson(sourceDoc.as<JsonVariantConst>(),
+                   targetDoc.as<JsonVariantConst>(), patch));
+
+  // applying the patch must give the target
+  REQUIRE(applyJsonPatch(sourceDoc, patch.as<JsonVariantConst>()) ==
+          DeserializationError::Ok);
+  REQUIRE(sourceDoc.as<JsonVariantConst>() == targetDoc.as<JsonVariantConst>());
+
+  std::string output;
+  serializeJson(patch, output);
+  return output;
+}
+
+TEST_CASE("diffJson()") {
+  SECTION("same documents") {
+    REQUIRE(diff("{\"a\":[1,{\"b\":true}]}", "{\"a\":[1,{\"b\":true}]}") ==
+            "[]");
+  }
+
+  SECTION("members in a different order") {
+    REQUIRE(diff("{\"a\":1,\"b\":2}", "{\"b\":2,\"a\":1}") == "[]");
+  }
+
+  SECTION("1 and 1.0 are equal") {
+    REQUIRE(diff("[1]", "[1.0]") == "[]");
+  }
+
+  SECTION("true and 1 are different") {
+    REQUIRE(diff("[1]", "[true]") ==
+            "[{\"op\":\"replace\",\"path\":\"/0\",\"value\":true}]");
+  }
+
+  SECTION("replace a member") {
+    REQUIRE(diff("{\"a\":1,\"b\":{\"c\":2}}", "{\"a\":1,\"b\":{\"c\":3}}") ==
+            "[{\"op\":\"replace\",\"path\":\"/b/c\",\"value\":3}]");
+  }
+
+  SECTION("add and remove members") {
+    REQUIRE(diff("{\"a\":1,\"b\":2}", "{\"b\":2,\"c\":\"x\"}") ==
+            "[{\"op\":\"remove\",\"path\":\"/a\"},"
+            "{\"op\":\"add\",\"path\":\"/c\",\"value\":\"x\"}]");
+  }
+
+  SECTION("remove elements from the end") {
+    REQUIRE(diff("[1,2,3,4]", "[1,2]") ==
+            "[{\"op\":\"remove\",\"path\":\"/3\"},"
+            "{\"op\":\"remove\",\"path\":\"/2\"}]");
+  }
+
+  SECTION("add elements at the end") {
+    REQUIRE(diff("[[1]]", "[[1,2],3]") ==
+            "[{\"op\":\"add\",\"path\":\"/0/-\",\"value\":2},"
+            "{\"op\":\"add\",\"path\":\"/-\",\"value\":3}]");
+  }
+
+  SECTION("replace the whole document") {
+    REQUIRE(diff("{\"a\":1}", "[1]") ==
+            "[{\"op\":\"replace\",\"path\":\"\",\"value\":[1]}]");
+  }
+
+  SECTION("escape the keys") {
+    REQUIRE(diff("{\"a/b\":1,\"c~d\":2}", "{\"a/b\":3,\"c~d\":2}") ==
+            "[{\"op\":\"replace\",\"path\":\"/a~1b\",\"value\":3}]");
+  }
+
+  SECTION("null target") {
+    DynamicJsonDocument source(4096);
+    DynamicJsonDocument patch(4096);
+    source["a"] = 1;
+
+    REQUIRE(diffJson(source.as<JsonVariantConst>(), JsonVariantConst(), patch));
+
+    std::string output;
+    serializeJson(patch, output);
+    REQUIRE(output == "[{\"op\":\"replace\",\"path\":\"\",\"value\":null}]");
+  }
+
+  SECTION("patch too small") {
+    DynamicJsonDocument source(4096);
+    DynamicJsonDocument target(4096);
+    StaticJsonDocument<JSON_ARRAY_SIZE(1)> patch;
+    deserializeJson(source, "{\"a\":1}");
+    deserializeJson(target, "{\"a\":2}");
+
+    REQUIRE_FALSE(diffJson(source.as<JsonVariantConst>(),
+                           target.as<JsonVariantConst>(), patch));
+  }
+}
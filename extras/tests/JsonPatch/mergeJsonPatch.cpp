@@ -0,0 +1,122 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string>
+
+static std::string merge(const char* target, const char* patch) {
+  DynamicJsonDocument doc(4096);
+  DynamicJsonDocument patchDoc(4096);
+  REQUIRE(deserializeJson(doc, target) == DeserializationError::Ok);
+  REQUIRE(deserializeJson(patchDoc, patch) == DeserializationError::Ok);
+  REQUIRE(mergeJsonPatch(doc, patchDoc.as<JsonVariantConst>()));
+  std::string output;
+  serializeJson(doc, output);
+  return output;
+}
+
+TEST_CASE("mergeJsonPatch()") {
+  SECTION("RFC 7396, appendix A") {
+    REQUIRE(merge("{\"a\":\"b\"}", "{\"a\":\"c\"}") == "{\"a\":\"c\"}");
+    REQUIRE(merge("{\"a\":\"b\"}", "{\"b\":\"c\"}") ==
+            "{\"a\":\"b\",\"b\":\"c\"}");
+    REQUIRE(merge("{\"a\":\"b\"}", "{\"a\":null}") == "{}");
+    REQUIRE(merge("{\"a\":\"b\",\"b\":\"c\"}", "{\"a\":null}") ==
+            "{\"b\":\"c\"}");
+    REQUIRE(merge("{\"a\":[\"b\"]}", "{\"a\":\"c\"}") == "{\"a\":\"c\"}");
+    REQUIRE(merge("{\"a\":\"c\"}", "{\"a\":[\"b\"]}") == "{\"a\":[\"b\"]}");
+    REQUIRE(merge("{\"a\":{\"b\":\"c\"}}",
+                  "{\"a\":{\"b\":\"d\",\"c\":null}}") ==
+            "{\"a\":{\"b\":\"d\"}}");
+    REQUIRE(merge("{\"a\":[{\"b\":\"c\"}]}", "{\"a\":[1]}") == "{\"a\":[1]}");
+    REQUIRE(merge("[\"a\",\"b\"]", "[\"c\",\"d\"]") == "[\"c\",\"d\"]");
+    REQUIRE(merge("{\"a\":\"b\"}", "[\"c\"]") == "[\"c\"]");
+    REQUIRE(merge("{\"a\":\"foo\"}", "null") == "null");
+    REQUIRE(merge("{\"a\":\"foo\"}", "\"bar\"") == "\"bar\"");
+    REQUIRE(merge("{\"e\":null}", "{\"a\":1}") == "{\"e\":null,\"a\":1}");
+    REQUIRE(merge("[1,2]", "{\"a\":\"b\",\"c\":null}") == "{\"a\":\"b\"}");
+    REQUIRE(merge("{}", "{\"a\":{\"bb\":{\"ccc\":null}}}") ==
+            "{\"a\":{\"bb\":{}}}");
+  }
+
+  SECTION("removes several members in a row") {
+    REQUIRE(merge("{\"a\":1,\"b\":2,\"c\":3,\"d\":4}",
+                  "{\"a\":null,\"b\":null,\"d\":null}") == "{\"c\":3}");
+    REQUIRE(merge("{\"a\":1,\"b\":2,\"c\":3}", "{\"c\":null,\"a\":null}") ==
+            "{\"b\":2}");
+  }
+
+  SECTION("layered configuration") {
+    DynamicJsonDocument config(4096);
+    DynamicJsonDocument site(4096);
+    DynamicJsonDocument device(4096);
+    deserializeJson(config, "{\"wifi\":{\"ssid\":\"default\",\"retries\":3},"
+                            "\"log\":\"info\"}");
+    deserializeJson(site, "{\"wifi\":{\"ssid\":\"site\"},\"ntp\":\"pool\"}");
+    deserializeJson(device, "{\"wifi\":{\"retries\":5},\"log\":null}");
+
+    REQUIRE(mergeJsonPatch(config, site.as<JsonVariantConst>()));
+    REQUIRE(mergeJsonPatch(config, device.as<JsonVariantConst>()));
+
+    std::string output;
+    serializeJson(config, output);
+    REQUIRE(output ==
+            "{\"wifi\":{\"ssid\":\"site\",\"retries\":5},\"ntp\":\"pool\"}");
+  }
+
+  SECTION("doesn't copy the values that didn't change") {
+    DynamicJsonDocument doc(4096);
+    DynamicJsonDocument patch(4096);
+    deserializeJson(doc, "{\"a\":{\"b\":\"hello\",\"c\":[1,2]}}");
+    deserializeJson(patch, "{\"a\":{\"b\":\"hello\",\"c\":[1,2]}}");
+    size_t before = doc.memoryUsage();
+
+    REQUIRE(mergeJsonPatch(doc, patch.as<JsonVariantConst>()));
+
+    REQUIRE(doc.memoryUsage() == before);
+  }
+
+  SECTION("links the linked strings") {
+    DynamicJsonDocument doc(4096);
+    DynamicJsonDocument patch(4096);
+    patch["key"] = "value";
+    REQUIRE(patch.memoryUsage() == JSON_OBJECT_SIZE(1));
+
+    REQUIRE(mergeJsonPatch(doc, patch.as<JsonVariantConst>()));
+
+    REQUIRE(doc["key"] == "value");
+    REQUIRE(doc.memoryUsage() == JSON_OBJECT_SIZE(1));
+  }
+
+  SECTION("merges into a member") {
+    DynamicJsonDocument doc(4096);
+    DynamicJsonDocument patch(4096);
+    deserializeJson(doc, "{\"a\":{\"b\":1}}");
+    deserializeJson(patch, "{\"c\":2}");
+
+    REQUIRE(mergeJsonPatch(doc["a"].as<JsonVariant>(),
+                           patch.as<JsonVariantConst>()));
+
+    std::string output;
+    serializeJson(doc, output);
+    REQUIRE(output == "{\"a\":{\"b\":1,\"c\":2}}");
+  }
+
+  SECTION("document too small") {
+    StaticJsonDocument<JSON_OBJECT_SIZE(1)> doc;
+    DynamicJsonDocument patch(4096);
+    deserializeJson(patch, "{\"a\":1,\"b\":2}");
+
+    REQUIRE_FALSE(mergeJsonPatch(doc, patch.as<JsonVariantConst>()));
+  }
+
+  SECTION("unbound target") {
+    DynamicJsonDocument patch(4096);
+    patch["a"] = 1;
+
+    REQUIRE_FALSE(mergeJsonPatch(JsonVariant(), patch.as<JsonVariantConst>()));
+  }
+}
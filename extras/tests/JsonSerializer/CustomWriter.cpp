@@ -50,3 +50,153 @@ TEST_CASE("CustomWriter") {
     REQUIRE("[\r\n  4,\r\n  2\r\n]" == writer.str());
   }
 }
+
+class SpyingWriter {
+ public:
+  SpyingWriter(size_t capacity = size_t(-1))
+      : _capacity(capacity), _calls(0) {}
+
+  size_t write(uint8_t c) {
+    return write(&c, 1);
+  }
+
+  size_t write(const uint8_t *s, size_t n) {
+    _calls++;
+    if (n > _capacity - _str.size())
+      n = _capacity - _str.size();
+    _str.append(reinterpret_cast<const char *>(s), n);
+    return n;
+  }
+
+  const std::string &str() const {
+    return _str;
+  }
+
+  int calls() const {
+    return _calls;
+  }
+
+ private:
+  SpyingWriter(const SpyingWriter &);  // non-copiable
+  SpyingWriter &operator=(const SpyingWriter &);
+
+  size_t _capacity;
+  std::string _str;
+  int _calls;
+};
+
+TEST_CASE("CustomWriter buffering") {
+  DynamicJsonDocument doc(32768);
+
+  SECTION("coalesces small writes") {
+    SpyingWriter writer;
+    deserializeJson(doc, "{\"hello\":[1,2,3],\"world\":true}");
+
+    size_t n = serializeJson(doc, writer);
+
+    REQUIRE(n == 30);
+    REQUIRE(writer.str() == "{\"hello\":[1,2,3],\"world\":true}");
+    REQUIRE(writer.calls() == 1);
+  }
+
+  SECTION("flushes when the buffer is full") {
+    SpyingWriter writer;
+    std::string expected = "[";
+    for (int i = 0; i < ARDUINOJSON_STREAM_BUFFER_SIZE; i++) {
+      doc.add(i % 10);
+      expected += (i ? ",0" : "0");
+      expected[expected.size() - 1] = static_cast<char>('0' + i % 10);
+    }
+    expected += "]";
+
+    size_t n = serializeJson(doc, writer);
+
+    REQUIRE(n == expected.size());
+    REQUIRE(writer.str() == expected);
+    REQUIRE(writer.calls() > 1);
+    REQUIRE(writer.calls() <= 1 + int(n / ARDUINOJSON_STREAM_BUFFER_SIZE));
+  }
+
+  SECTION("sends long strings directly") {
+    SpyingWriter writer;
+    std::string s(ARDUINOJSON_STREAM_BUFFER_SIZE, 'x');
+    doc.add(serialized(s));
+
+    size_t n = serializeJson(doc, writer);
+
+    REQUIRE(n == s.size() + 2);
+    REQUIRE(writer.str() == "[" + s + "]");
+    REQUIRE(writer.calls() == 3);
+  }
+
+  SECTION("returns the number of bytes accepted by the writer") {
+    SpyingWriter writer(4);
+    deserializeJson(doc, "[1,2,3]");
+
+    size_t n = serializeJson(doc, writer);
+
+    REQUIRE(n == 4);
+    REQUIRE(writer.str() == "[1,2");
+  }
+
+  SECTION("MessagePack") {
+    SpyingWriter writer;
+    deserializeJson(doc, "{\"hello\":[1,2,3]}");
+
+    size_t n = serializeMsgPack(doc, writer);
+
+    REQUIRE(n == 11);
+    REQUIRE(writer.str() == "\x81\xA5hello\x93\x01\x02\x03");
+    REQUIRE(writer.calls() == 1);
+  }
+
+  SECTION("JsonStreamWriter flushes when the root is complete") {
+    SpyingWriter writer;
+    JsonStreamWriter<SpyingWriter> stream(writer);
+
+    stream.beginArray();
+    stream.value(1);
+    stream.value("two");
+    REQUIRE(writer.calls() == 0);
+
+    stream.endArray();
+    REQUIRE(writer.str() == "[1,\"two\"]");
+    REQUIRE(writer.calls() == 1);
+  }
+
+  SECTION("JsonStreamWriter::flush()") {
+    SpyingWriter writer;
+    JsonStreamWriter<SpyingWriter> stream(writer);
+
+    stream.beginArray();
+    stream.value(1);
+    stream.flush();
+
+    REQUIRE(writer.str() == "[1");
+  }
+
+  SECTION("MsgPackStreamWriter flushes when the root is complete") {
+    SpyingWriter writer;
+    MsgPackStreamWriter<SpyingWriter> stream(writer);
+
+    stream.beginArray(2);
+    stream.value(1);
+    stream.value(2);
+    REQUIRE(writer.calls() == 0);
+
+    stream.endArray();
+    REQUIRE(writer.str() == "\x92\x01\x02");
+    REQUIRE(writer.calls() == 1);
+  }
+
+  SECTION("transcodeMsgPackToJson()") {
+    SpyingWriter writer;
+
+    DeserializationError err =
+        transcodeMsgPackToJson("\x81\xA5hello\x93\x01\x02\x03", writer);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(writer.str() == "{\"hello\":[1,2,3]}");
+    REQUIRE(writer.calls() == 1);
+  }
+}
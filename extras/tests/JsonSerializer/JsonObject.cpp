@@ -116,4 +116,23 @@ TEST_CASE("serializeJson(JsonObject)") {
 
     checkObject(obj, "{\"a\":{},\"b\":{},\"c\":{}}");
   }
+
+  SECTION("Escaped key") {
+    obj["a\"b\\c\nd"] = 1;
+
+    checkObject(obj, "{\"a\\\"b\\\\c\\nd\":1}");
+  }
+
+  SECTION("Key longer than 65535 characters") {
+    DynamicJsonDocument big(JSON_OBJECT_SIZE(1) + 70001);
+    std::string key(70000, 'k');
+    big[key] = 1;
+
+    std::string json;
+    serializeJson(big, json);
+
+    REQUIRE(json == "{\"" + key + "\":1}");
+    REQUIRE(big[key] == 1);
+    REQUIRE(big.as<JsonObject>().begin()->key().size() == 70000);
+  }
 }
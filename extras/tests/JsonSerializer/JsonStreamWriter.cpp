@@ -0,0 +1,171 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+#include <sstream>
+
+TEST_CASE("JsonStreamWriter") {
+  std::string output;
+  JsonStreamWriter<std::string> writer(output);
+
+  SECTION("scalar") {
+    REQUIRE(writer.value(42));
+    REQUIRE(writer.complete());
+    REQUIRE(output == "42");
+    REQUIRE(writer.bytesWritten() == 2);
+  }
+
+  SECTION("empty object") {
+    REQUIRE(writer.beginObject());
+    REQUIRE(writer.endObject());
+    REQUIRE(output == "{}");
+  }
+
+  SECTION("empty array") {
+    REQUIRE(writer.beginArray());
+    REQUIRE(writer.endArray());
+    REQUIRE(output == "[]");
+  }
+
+  SECTION("values") {
+    writer.beginArray();
+    writer.value(true);
+    writer.value(-1);
+    writer.value(42U);
+    writer.value(1.5);
+    writer.value("hello");
+    writer.value(std::string("wor\"ld"));
+    writer.value(static_cast<const char*>(0));
+    writer.value(serialized("[1,2]"));
+    REQUIRE(writer.endArray());
+
+    REQUIRE(output == "[true,-1,42,1.5,\"hello\",\"wor\\\"ld\",null,[1,2]]");
+    REQUIRE(writer.bytesWritten() == output.size());
+  }
+
+  SECTION("nested") {
+    writer.beginObject();
+    writer.key("a");
+    writer.value(1);
+    writer.key(std::string("b"));
+    writer.beginArray();
+    writer.beginObject();
+    writer.endObject();
+    writer.value(2);
+    writer.endArray();
+    writer.key("c");
+    writer.beginObject();
+    writer.key("d");
+    writer.value(3);
+    writer.endObject();
+    REQUIRE(writer.endObject());
+
+    REQUIRE(writer.complete());
+    REQUIRE_FALSE(writer.failed());
+    REQUIRE(output == "{\"a\":1,\"b\":[{},2],\"c\":{\"d\":3}}");
+  }
+
+  SECTION("inline subtree") {
+    StaticJsonDocument<JSON_OBJECT_SIZE(2)> doc;
+    doc["x"] = 1;
+    doc["y"] = 2;
+
+    writer.beginArray();
+    writer.value(doc);
+    writer.value(doc["y"]);
+    writer.value(doc.as<JsonObjectConst>());
+    REQUIRE(writer.endArray());
+
+    REQUIRE(output == "[{\"x\":1,\"y\":2},2,{\"x\":1,\"y\":2}]");
+  }
+
+  SECTION("rejects a value instead of a key") {
+    writer.beginObject();
+
+    REQUIRE_FALSE(writer.value(1));
+    REQUIRE(writer.failed());
+  }
+
+  SECTION("rejects a key in an array") {
+    writer.beginArray();
+
+    REQUIRE_FALSE(writer.key("a"));
+  }
+
+  SECTION("rejects a key without value") {
+    writer.beginObject();
+    writer.key("a");
+
+    REQUIRE_FALSE(writer.endObject());
+  }
+
+  SECTION("rejects mismatched end") {
+    writer.beginObject();
+
+    REQUIRE_FALSE(writer.endArray());
+  }
+
+  SECTION("rejects end at root") {
+    REQUIRE_FALSE(writer.endArray());
+  }
+
+  SECTION("rejects a second root") {
+    writer.value(1);
+
+    REQUIRE_FALSE(writer.value(2));
+    REQUIRE(output == "1");
+  }
+
+  SECTION("ignores all calls after a rejection") {
+    writer.beginArray();
+    writer.key("a");
+
+    REQUIRE_FALSE(writer.value(1));
+    REQUIRE_FALSE(writer.endArray());
+    REQUIRE(output == "[");
+  }
+
+  SECTION("null key") {
+    writer.beginObject();
+
+    REQUIRE_FALSE(writer.key(static_cast<const char*>(0)));
+  }
+}
+
+TEST_CASE("JsonStreamWriter nesting limit") {
+  std::string output;
+  JsonStreamWriter<std::string, 2> writer(output);
+
+  REQUIRE(writer.beginArray());
+  REQUIRE(writer.beginArray());
+  REQUIRE_FALSE(writer.beginArray());
+  REQUIRE(output == "[[");
+}
+
+TEST_CASE("JsonStreamWriter with a nesting limit of 0") {
+  std::string output;
+  JsonStreamWriter<std::string, 0> writer(output);
+
+  SECTION("accepts a scalar") {
+    REQUIRE(writer.value(42));
+    REQUIRE(output == "42");
+  }
+
+  SECTION("rejects a container") {
+    REQUIRE_FALSE(writer.beginObject());
+    REQUIRE(output == "");
+  }
+}
+
+TEST_CASE("JsonStreamWriter to std::ostream") {
+  std::ostringstream output;
+  JsonStreamWriter<std::ostream> writer(output);
+
+  writer.beginArray();
+  for (int i = 0; i < 3; i++) writer.value(i);
+  writer.endArray();
+
+  REQUIRE(output.str() == "[0,1,2]");
+}
@@ -77,6 +77,19 @@ TEST_CASE("serializeJson(JsonVariant)") {
     check(serialized(std::string("[1,2]")), "[1,2]");
   }
 
+  SECTION("MsgPackBinary") {
+    check(MsgPackBinary("", 0), "\"\"");
+    check(MsgPackBinary("f", 1), "\"Zg==\"");
+    check(MsgPackBinary("fo", 2), "\"Zm8=\"");
+    check(MsgPackBinary("foo", 3), "\"Zm9v\"");
+    check(MsgPackBinary("foob", 4), "\"Zm9vYg==\"");
+    check(MsgPackBinary("\xFB\xFF", 2), "\"+/8=\"");
+  }
+
+  SECTION("MsgPackExtension") {
+    check(MsgPackExtension(1, "foo", 3), "\"Zm9v\"");
+  }
+
   SECTION("Double") {
     check(3.1415927, "3.1415927");
   }
@@ -6,6 +6,39 @@
 #include <catch.hpp>
 #include <sstream>
 
+// A streambuf that accepts a limited number of chars and counts the syncs
+class LimitedStreamBuf : public std::streambuf {
+ public:
+  LimitedStreamBuf(size_t capacity) : _capacity(capacity), _syncs(0) {}
+
+  const std::string& str() const {
+    return _str;
+  }
+
+  int syncs() const {
+    return _syncs;
+  }
+
+ protected:
+  int_type overflow(int_type c) {
+    if (_str.size() >= _capacity ||
+        traits_type::eq_int_type(c, traits_type::eof()))
+      return traits_type::eof();
+    _str += traits_type::to_char_type(c);
+    return c;
+  }
+
+  int sync() {
+    _syncs++;
+    return 0;
+  }
+
+ private:
+  size_t _capacity;
+  std::string _str;
+  int _syncs;
+};
+
 TEST_CASE("operator<<(std::ostream)") {
   DynamicJsonDocument doc(4096);
   std::ostringstream os;
@@ -64,3 +97,52 @@ TEST_CASE("operator<<(std::ostream)") {
     REQUIRE("\"value\"" == os.str());
   }
 }
+
+TEST_CASE("serializeJson(std::ostream&)") {
+  DynamicJsonDocument doc(4096);
+  deserializeJson(doc, "[1,2,3]");
+
+  SECTION("leaves the stream in a good state") {
+    std::ostringstream os;
+
+    size_t n = serializeJson(doc, os);
+
+    REQUIRE(n == 7);
+    REQUIRE(os.good());
+    REQUIRE(os.str() == "[1,2,3]");
+  }
+
+  SECTION("sets badbit when the streambuf is full") {
+    LimitedStreamBuf buf(4);
+    std::ostream os(&buf);
+
+    size_t n = serializeJson(doc, os);
+
+    REQUIRE(n == 4);
+    REQUIRE(os.bad());
+    REQUIRE(buf.str() == "[1,2");
+  }
+
+  SECTION("doesn't write to a stream in a failed state") {
+    LimitedStreamBuf buf(100);
+    std::ostream os(&buf);
+    os.setstate(std::ios::failbit);
+
+    size_t n = serializeJson(doc, os);
+
+    REQUIRE(n == 0);
+    REQUIRE(buf.str() == "");
+  }
+
+  SECTION("flushes when unitbuf is set") {
+    LimitedStreamBuf buf(100);
+    std::ostream os(&buf);
+    os << std::unitbuf;
+    int syncs = buf.syncs();
+
+    serializeJson(doc, os);
+
+    REQUIRE(buf.str() == "[1,2,3]");
+    REQUIRE(buf.syncs() > syncs);
+  }
+}
@@ -0,0 +1,69 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+static uint32_t hashOf(const char* json) {
+  DynamicJsonDocument doc(4096);
+  deserializeJson(doc, json);
+  return doc.as<JsonVariantConst>().hash();
+}
+
+TEST_CASE("JsonVariant::hash()") {
+  DynamicJsonDocument doc(4096);
+  JsonVariant var = doc.to<JsonVariant>();
+
+  SECTION("unbound variant hashes like null") {
+    JsonVariant unbound;
+    REQUIRE(unbound.hash() == var.hash());
+  }
+
+  SECTION("ignores the order of the members") {
+    REQUIRE(hashOf("{\"a\":1,\"b\":[2,3],\"c\":{\"d\":4,\"e\":5}}") ==
+            hashOf("{\"c\":{\"e\":5,\"d\":4},\"b\":[2,3],\"a\":1}"));
+  }
+
+  SECTION("depends on the order of the elements") {
+    REQUIRE(hashOf("[1,2]") != hashOf("[2,1]"));
+  }
+
+  SECTION("1 and 1.0 have the same hash") {
+    REQUIRE(hashOf("1") == hashOf("1.0"));
+    REQUIRE(hashOf("-3") == hashOf("-3.0"));
+    REQUIRE(hashOf("[1]") == hashOf("[1.0]"));
+  }
+
+  SECTION("true and 1 have the same hash") {
+    REQUIRE(hashOf("true") == hashOf("1"));
+    REQUIRE(hashOf("false") == hashOf("0"));
+  }
+
+  SECTION("linked and copied strings have the same hash") {
+    DynamicJsonDocument doc2(4096);
+    doc2.set(std::string("hello"));
+    var.set("hello");
+    REQUIRE(var.hash() == doc2.as<JsonVariant>().hash());
+  }
+
+  SECTION("different values have different hashes") {
+    REQUIRE(hashOf("1") != hashOf("2"));
+    REQUIRE(hashOf("1.5") != hashOf("1"));
+    REQUIRE(hashOf("\"1\"") != hashOf("1"));
+    REQUIRE(hashOf("null") != hashOf("0"));
+    REQUIRE(hashOf("[]") != hashOf("{}"));
+    REQUIRE(hashOf("{\"a\":1}") != hashOf("{\"b\":1}"));
+    REQUIRE(hashOf("{\"a\":1}") != hashOf("{\"a\":2}"));
+    REQUIRE(hashOf("{\"a\":1,\"b\":2}") != hashOf("{\"a\":2,\"b\":1}"));
+  }
+
+  SECTION("JsonDocument, JsonArray, and JsonObject have the same hash") {
+    deserializeJson(doc, "{\"a\":[1,2]}");
+    REQUIRE(doc.hash() == doc.as<JsonVariant>().hash());
+    REQUIRE(doc.hash() == doc.as<JsonObject>().hash());
+    REQUIRE(doc.hash() == doc.as<JsonObjectConst>().hash());
+    REQUIRE(doc["a"].as<JsonArray>().hash() == hashOf("[1,2]"));
+    REQUIRE(doc["a"].as<JsonArrayConst>().hash() == hashOf("[1,2]"));
+  }
+}
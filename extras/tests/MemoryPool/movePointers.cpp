@@ -0,0 +1,66 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string.h>  // memcpy, memset
+#include <string>
+
+using namespace ARDUINOJSON_NAMESPACE;
+
+static const size_t poolCapacity = 512;
+
+// Moves the whole pool to another buffer, like realloc() or memcpy() would,
+// and only patches the root variant
+static void relocate(MemoryPool& pool, VariantData& root, char* from,
+                     char* to) {
+  memcpy(to, from, poolCapacity);
+  memset(from, '#', poolCapacity);
+  ptrdiff_t distance = to - from;
+  pool.movePointers(distance);
+  root.movePointers(distance, distance);
+}
+
+TEST_CASE("MemoryPool::movePointers()") {
+  char buffer1[poolCapacity], buffer2[poolCapacity];
+  MemoryPool pool(buffer1, sizeof(buffer1));
+  VariantData root;
+  root.init();
+  VariantRef var(&pool, &root);
+
+  SECTION("owned string") {
+    var.set(std::string("hello"));
+
+    relocate(pool, root, buffer1, buffer2);
+
+    REQUIRE(var.as<std::string>() == "hello");
+  }
+
+  SECTION("nested collections") {
+    var[std::string("array")][0] = std::string("hello");
+    var["array"][1] = serialized(std::string("[1,2]"));
+    var["object"]["key"] = 42;
+
+    relocate(pool, root, buffer1, buffer2);
+
+    std::string json;
+    serializeJson(var, json);
+    REQUIRE(json == "{\"array\":[\"hello\",[1,2]],\"object\":{\"key\":42}}");
+  }
+
+  SECTION("pool can still be modified") {
+    var.add(1);
+
+    relocate(pool, root, buffer1, buffer2);
+    var.add(std::string("two"));
+
+    std::string json;
+    serializeJson(var, json);
+    REQUIRE(json == "[1,\"two\"]");
+    const char* two = var[1];
+    REQUIRE(two >= buffer2);
+    REQUIRE(two < buffer2 + poolCapacity);
+  }
+}
@@ -0,0 +1,21 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#define ARDUINOJSON_NAMESPACE ArduinoJson_NoSlotKeyHash
+#define ARDUINOJSON_SLOT_KEY_HASH 0
+#include <ArduinoJson.h>
+
+#include <catch.hpp>
+
+TEST_CASE("ARDUINOJSON_SLOT_KEY_HASH == 0") {
+  DynamicJsonDocument doc(4096);
+  deserializeJson(doc, "{\"a\":1,\"iz\":2}");
+
+  REQUIRE(doc["a"] == 1);
+  REQUIRE(doc["iz"] == 2);
+  REQUIRE(doc[JsonKey("iz")] == 2);
+  REQUIRE(doc["b"].isNull());
+  REQUIRE(sizeof(ARDUINOJSON_NAMESPACE::VariantSlot) ==
+          JSON_OBJECT_SIZE(1));
+}
@@ -0,0 +1,26 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#define ARDUINOJSON_NAMESPACE ArduinoJson_NoSlotKeySize
+#define ARDUINOJSON_SLOT_KEY_SIZE 0
+#include <ArduinoJson.h>
+
+#include <catch.hpp>
+
+#include <string>
+
+TEST_CASE("ARDUINOJSON_SLOT_KEY_SIZE == 0") {
+  DynamicJsonDocument doc(4096);
+  deserializeJson(doc, "{\"a\":1,\"abc\":2,\"x\\u0000y\":3}");
+
+  REQUIRE(doc["a"] == 1);
+  REQUIRE(doc["abc"] == 2);
+  REQUIRE(doc["x"] == 3);
+  REQUIRE(doc["ab"].isNull());
+  REQUIRE(doc.as<JsonObject>().begin()->key().size() == 1);
+
+  std::string json;
+  serializeJson(doc, json);
+  REQUIRE(json == "{\"a\":1,\"abc\":2,\"x\":3}");
+}
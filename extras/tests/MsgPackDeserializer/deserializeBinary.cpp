@@ -0,0 +1,214 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+static void checkBinary(const char* input, size_t inputSize,
+                        const std::string& expected) {
+  DynamicJsonDocument doc(inputSize + 64);
+
+  DeserializationError error = deserializeMsgPack(doc, input, inputSize);
+
+  REQUIRE(error == DeserializationError::Ok);
+  REQUIRE(doc.is<MsgPackBinary>());
+  MsgPackBinary bin = doc.as<MsgPackBinary>();
+  REQUIRE(std::string(reinterpret_cast<const char*>(bin.data()), bin.size()) ==
+          expected);
+
+  std::string output;
+  serializeMsgPack(doc, output);
+  REQUIRE(output == std::string(input, inputSize));
+}
+
+static void checkExtension(const char* input, size_t inputSize, int8_t type,
+                           const std::string& expected) {
+  DynamicJsonDocument doc(inputSize + 64);
+
+  DeserializationError error = deserializeMsgPack(doc, input, inputSize);
+
+  REQUIRE(error == DeserializationError::Ok);
+  REQUIRE(doc.is<MsgPackExtension>());
+  MsgPackExtension ext = doc.as<MsgPackExtension>();
+  REQUIRE(ext.type() == type);
+  REQUIRE(std::string(reinterpret_cast<const char*>(ext.data()), ext.size()) ==
+          expected);
+
+  std::string output;
+  serializeMsgPack(doc, output);
+  REQUIRE(output == std::string(input, inputSize));
+}
+
+TEST_CASE("deserialize MsgPack binary") {
+  SECTION("bin 8") {
+    checkBinary("\xc4\x00", 2, "");
+    checkBinary("\xc4\x03\x01\x00\x02", 5, std::string("\x01\x00\x02", 3));
+  }
+
+  SECTION("bin 16") {
+    std::string input("\xc5\x01\x00", 3);
+    input.append(256, '\x00');
+    checkBinary(input.data(), input.size(), std::string(256, '\x00'));
+  }
+
+  SECTION("bin 32") {
+    std::string input("\xc6\x00\x01\x00\x00", 5);
+    input.append(65536, 'x');
+    checkBinary(input.data(), input.size(), std::string(65536, 'x'));
+  }
+
+  SECTION("JSON output") {
+    DynamicJsonDocument doc(4096);
+    deserializeMsgPack(doc, "\x92\xc4\x01X\x2A", 5);
+
+    REQUIRE(doc.as<std::string>() == "[\"WA==\",42]");
+  }
+
+  SECTION("linked to the input when deserializing in place") {
+    DynamicJsonDocument doc(4096);
+    char input[] = "\x91\xc4\x03\x01\x00\x02";
+
+    deserializeMsgPack(doc, input, sizeof(input) - 1);
+
+    MsgPackBinary bin = doc[0];
+    REQUIRE(bin.size() == 3);
+    REQUIRE(reinterpret_cast<const char*>(bin.data()) >= input);
+    REQUIRE(reinterpret_cast<const char*>(bin.data()) < input + sizeof(input));
+    REQUIRE(doc.memoryUsage() == JSON_ARRAY_SIZE(1));
+  }
+
+  SECTION("copied to the pool otherwise") {
+    DynamicJsonDocument doc(4096);
+
+    deserializeMsgPack(doc, "\x91\xc4\x03\x01\x00\x02", 6);
+
+    REQUIRE(doc.memoryUsage() == JSON_ARRAY_SIZE(1) + 4);
+  }
+
+  SECTION("NoMemory") {
+    StaticJsonDocument<JSON_ARRAY_SIZE(1)> doc;
+
+    DeserializationError error =
+        deserializeMsgPack(doc, "\x91\xc4\x03\x01\x00\x02", 6);
+
+    REQUIRE(error == DeserializationError::NoMemory);
+  }
+
+  SECTION("IncompleteInput") {
+    DynamicJsonDocument doc(4096);
+
+    DeserializationError error = deserializeMsgPack(doc, "\xc4\x03\x01\x00", 4);
+
+    REQUIRE(error == DeserializationError::IncompleteInput);
+  }
+}
+
+TEST_CASE("deserialize MsgPack extension") {
+  SECTION("fixext 1") {
+    checkExtension("\xd4\x01\x02", 3, 1, "\x02");
+  }
+
+  SECTION("fixext 2") {
+    checkExtension("\xd5\x02\x01\x02", 4, 2, "\x01\x02");
+  }
+
+  SECTION("fixext 4") {
+    checkExtension("\xd6\x7f\x01\x02\x03\x04", 6, 127, "\x01\x02\x03\x04");
+  }
+
+  SECTION("fixext 8") {
+    checkExtension("\xd7\x80\x01\x02\x03\x04\x05\x06\x07\x08", 10, -128,
+                   "\x01\x02\x03\x04\x05\x06\x07\x08");
+  }
+
+  SECTION("fixext 16") {
+    checkExtension(
+        "\xd8\x05\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0A\x0B\x0C\x0D\x0E"
+        "\x0F\x10",
+        18, 5,
+        "\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0A\x0B\x0C\x0D\x0E\x0F\x10");
+  }
+
+  SECTION("ext 8") {
+    checkExtension("\xc7\x00\x01", 3, 1, "");
+    checkExtension("\xc7\x03\x01\x01\x02\x03", 6, 1, "\x01\x02\x03");
+  }
+
+  SECTION("ext 16") {
+    std::string input("\xc8\x01\x00\x09", 4);
+    input.append(256, 'x');
+    checkExtension(input.data(), input.size(), 9, std::string(256, 'x'));
+  }
+
+  SECTION("ext 32") {
+    std::string input("\xc9\x00\x01\x00\x00\x09", 6);
+    input.append(65536, 'x');
+    checkExtension(input.data(), input.size(), 9, std::string(65536, 'x'));
+  }
+
+  SECTION("JSON output") {
+    DynamicJsonDocument doc(4096);
+    deserializeMsgPack(doc, "\x92\xc7\x01\x01\x01\x2A", 6);
+
+    REQUIRE(doc.as<std::string>() == "[\"AQ==\",42]");
+  }
+
+  SECTION("not a binary") {
+    DynamicJsonDocument doc(4096);
+    deserializeMsgPack(doc, "\xd4\x01\x02", 3);
+
+    REQUIRE(doc.is<MsgPackBinary>() == false);
+    REQUIRE(doc.as<MsgPackBinary>().data() == 0);
+  }
+
+  SECTION("IncompleteInput") {
+    DynamicJsonDocument doc(4096);
+
+    DeserializationError error = deserializeMsgPack(doc, "\xd6\x01\x01\x02", 4);
+
+    REQUIRE(error == DeserializationError::IncompleteInput);
+  }
+}
+
+TEST_CASE("deserialize MsgPack timestamp") {
+  DynamicJsonDocument doc(4096);
+
+  SECTION("timestamp 32") {
+    deserializeMsgPack(doc, "\xd6\xff\x5f\x5e\x10\x00", 6);
+
+    REQUIRE(doc.is<MsgPackTimestamp>());
+    REQUIRE(doc.as<MsgPackTimestamp>().seconds() == 0x5f5e1000);
+    REQUIRE(doc.as<MsgPackTimestamp>().nanoseconds() == 0);
+  }
+
+  SECTION("timestamp 64") {
+    deserializeMsgPack(doc, "\xd7\xff\x00\x00\x00\x04\x00\x00\x00\x01", 10);
+
+    REQUIRE(doc.is<MsgPackTimestamp>());
+    REQUIRE(doc.as<MsgPackTimestamp>().seconds() == 1);
+    REQUIRE(doc.as<MsgPackTimestamp>().nanoseconds() == 1);
+  }
+
+  SECTION("timestamp 96") {
+    deserializeMsgPack(
+        doc, "\xc7\x0c\xff\x00\x00\x00\x02\xff\xff\xff\xff\xff\xff\xff\xfe",
+        15);
+
+    REQUIRE(doc.is<MsgPackTimestamp>());
+    REQUIRE(doc.as<MsgPackTimestamp>().seconds() == -2);
+    REQUIRE(doc.as<MsgPackTimestamp>().nanoseconds() == 2);
+  }
+
+  SECTION("wrong type") {
+    deserializeMsgPack(doc, "\xd6\x01\x5f\x5e\x10\x00", 6);
+
+    REQUIRE(doc.is<MsgPackTimestamp>() == false);
+  }
+
+  SECTION("wrong size") {
+    deserializeMsgPack(doc, "\xd5\xff\x10\x00", 4);
+
+    REQUIRE(doc.is<MsgPackTimestamp>() == false);
+  }
+}
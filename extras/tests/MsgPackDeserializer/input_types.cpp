@@ -2,11 +2,19 @@
 // Copyright © 2014-2022, Benoit BLANCHON
 // MIT License
 
+#if defined(__unix__) || defined(__APPLE__)
+#  define ARDUINOJSON_ENABLE_MMAP 1  // MappedFile is opt-in
+#endif
 #include <ArduinoJson.h>
 #include <catch.hpp>
+#include <vector>
 
 #include "CustomReader.hpp"
 
+#if ARDUINOJSON_ENABLE_MMAP
+#  include "TempFile.hpp"
+#endif
+
 TEST_CASE("deserializeMsgPack(const std::string&)") {
   DynamicJsonDocument doc(4096);
 
@@ -68,6 +76,16 @@ TEST_CASE("deserializeMsgPack(std::istream&)") {
 
     REQUIRE(err == DeserializationError::IncompleteInput);
   }
+
+  SECTION("should set eofbit when a string is truncated") {
+    std::istringstream input("\xA5hel");
+
+    DeserializationError err = deserializeMsgPack(doc, input);
+
+    REQUIRE(err == DeserializationError::IncompleteInput);
+    REQUIRE(input.eof());
+    REQUIRE(input.fail());
+  }
 }
 
 #ifdef HAS_VARIABLE_LENGTH_ARRAY
@@ -93,3 +111,81 @@ TEST_CASE("deserializeMsgPack(CustomReader)") {
   REQUIRE(doc[0] == "Hello");
   REQUIRE(doc[1] == "world");
 }
+
+#if ARDUINOJSON_ENABLE_MMAP
+TEST_CASE("deserializeMsgPack(MappedFile)") {
+  DynamicJsonDocument doc(4096);
+  TempFile tmp("\x92\xA5Hello\xA5world", 13);
+  MappedFile file(tmp.path());
+
+  DeserializationError err = deserializeMsgPack(doc, file);
+
+  REQUIRE(err == DeserializationError::Ok);
+  REQUIRE(doc.size() == 2);
+  REQUIRE(doc[0] == "Hello");
+  REQUIRE(doc[1] == "world");
+}
+#endif
+
+TEST_CASE("deserializeMsgPack() with long strings") {
+  DynamicJsonDocument doc(4096);
+  std::string value(300, 'x');
+  std::string input = "\x92\xDA\x01\x2C" + value + "\x2A";
+
+  SECTION("const std::string&") {
+    DeserializationError err = deserializeMsgPack(doc, input);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc[0] == value);
+    REQUIRE(doc[1] == 42);
+  }
+
+  SECTION("std::istream&") {
+    std::istringstream stream(input);
+
+    DeserializationError err = deserializeMsgPack(doc, stream);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc[0] == value);
+    REQUIRE(doc[1] == 42);
+  }
+
+  SECTION("char* (zero-copy)") {
+    std::vector<char> buffer(input.begin(), input.end());
+
+    DeserializationError err =
+        deserializeMsgPack(doc, &buffer[0], buffer.size());
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc[0] == value);
+    REQUIRE(doc[1] == 42);
+  }
+
+  SECTION("truncated") {
+    DeserializationError err =
+        deserializeMsgPack(doc, input.c_str(), input.size() - 10);
+
+    REQUIRE(err == DeserializationError::IncompleteInput);
+  }
+
+  SECTION("too long for the pool") {
+    StaticJsonDocument<JSON_ARRAY_SIZE(2) + 100> smallDoc;
+
+    DeserializationError err = deserializeMsgPack(smallDoc, input);
+
+    REQUIRE(err == DeserializationError::NoMemory);
+  }
+
+  SECTION("skipped by a CustomReader") {
+    std::string bin = "\x82\xA1" "a" "\xC5\x01\x2C" + value + "\xA1" "b" "\x2A";
+    CustomReader reader(bin.c_str());
+    StaticJsonDocument<JSON_OBJECT_SIZE(1)> filter;
+    filter["b"] = true;
+
+    DeserializationError err = deserializeMsgPack(
+        doc, reader, DeserializationOption::Filter(filter));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "{\"b\":42}");
+  }
+}
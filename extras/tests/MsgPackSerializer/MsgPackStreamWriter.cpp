@@ -0,0 +1,76 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+TEST_CASE("MsgPackStreamWriter") {
+  std::string output;
+  MsgPackStreamWriter<std::string> writer(output);
+
+  SECTION("scalar") {
+    REQUIRE(writer.value(42));
+    REQUIRE(writer.complete());
+    REQUIRE(output == "\x2A");
+  }
+
+  SECTION("nested") {
+    writer.beginObject(2);
+    writer.key("a");
+    writer.value(1);
+    writer.key("b");
+    writer.beginArray(3);
+    writer.value(true);
+    writer.value("hi");
+    writer.value(MsgPackBinary("\x01", 1));
+    writer.endArray();
+    REQUIRE(writer.endObject());
+
+    REQUIRE(writer.complete());
+    REQUIRE(output == "\x82\xA1" "a\x01\xA1" "b\x93\xC3\xA2hi\xC4\x01\x01");
+    REQUIRE(writer.bytesWritten() == output.size());
+  }
+
+  SECTION("large array") {
+    writer.beginArray(16);
+    for (int i = 0; i < 16; i++) writer.value(0);
+    REQUIRE(writer.endArray());
+
+    REQUIRE(output == std::string("\xDC\x00\x10", 3) + std::string(16, '\0'));
+  }
+
+  SECTION("produces the same output as serializeMsgPack()") {
+    DynamicJsonDocument doc(4096);
+    deserializeJson(doc, "{\"id\":1,\"tags\":[\"x\",\"y\"],\"pi\":3.14}");
+
+    writer.beginArray(1);
+    writer.value(doc);
+    writer.endArray();
+
+    std::string expected;
+    serializeMsgPack(doc, expected);
+    REQUIRE(output == "\x91" + expected);
+  }
+
+  SECTION("rejects more items than announced") {
+    writer.beginArray(1);
+    writer.value(1);
+
+    REQUIRE_FALSE(writer.value(2));
+  }
+
+  SECTION("rejects fewer items than announced") {
+    writer.beginObject(2);
+    writer.key("a");
+    writer.value(1);
+
+    REQUIRE_FALSE(writer.endObject());
+  }
+
+  SECTION("rejects a value instead of a key") {
+    writer.beginObject(1);
+
+    REQUIRE_FALSE(writer.value(1));
+  }
+}
@@ -8,7 +8,7 @@
 template <typename T>
 static void checkVariant(T value, const char* expected_data,
                          size_t expected_len) {
-  DynamicJsonDocument doc(4096);
+  DynamicJsonDocument doc(expected_len + 4096);
   JsonVariant variant = doc.to<JsonVariant>();
   variant.set(value);
   std::string expected(expected_data, expected_data + expected_len);
@@ -160,3 +160,83 @@ TEST_CASE("serialize MsgPack value") {
     checkVariant(256.0, "\xCD\x01\x00");
   }
 }
+
+TEST_CASE("serialize MsgPack binary") {
+  SECTION("bin 8") {
+    checkVariant(MsgPackBinary("", 0), "\xC4\x00", 2);
+    checkVariant(MsgPackBinary("\x01\x00\x02", 3), "\xC4\x03\x01\x00\x02", 5);
+  }
+
+  SECTION("bin 16") {
+    std::string data(256, 'x');
+    checkVariant(MsgPackBinary(data.data(), data.size()),
+                 std::string("\xC5\x01\x00", 3) + data);
+  }
+
+  SECTION("bin 32") {
+    std::string data(65536, 'x');
+    checkVariant(MsgPackBinary(data.data(), data.size()),
+                 std::string("\xC6\x00\x01\x00\x00", 5) + data);
+  }
+}
+
+TEST_CASE("serialize MsgPack extension") {
+  SECTION("fixext 1") {
+    checkVariant(MsgPackExtension(1, "\x02", 1), "\xD4\x01\x02");
+  }
+
+  SECTION("fixext 2") {
+    checkVariant(MsgPackExtension(-2, "\x01\x02", 2), "\xD5\xFE\x01\x02");
+  }
+
+  SECTION("fixext 4") {
+    checkVariant(MsgPackExtension(3, "\x01\x02\x03\x04", 4),
+                 "\xD6\x03\x01\x02\x03\x04");
+  }
+
+  SECTION("fixext 8") {
+    checkVariant(MsgPackExtension(3, "12345678", 8), "\xD7\x03"
+                                                      "12345678");
+  }
+
+  SECTION("fixext 16") {
+    checkVariant(MsgPackExtension(3, "0123456789ABCDEF", 16),
+                 "\xD8\x03"
+                 "0123456789ABCDEF");
+  }
+
+  SECTION("ext 8") {
+    checkVariant(MsgPackExtension(3, "", 0), "\xC7\x00\x03", 3);
+    checkVariant(MsgPackExtension(3, "123", 3), "\xC7\x03\x03"
+                                                 "123");
+  }
+
+  SECTION("ext 16") {
+    std::string data(256, 'x');
+    checkVariant(MsgPackExtension(3, data.data(), data.size()),
+                 std::string("\xC8\x01\x00\x03", 4) + data);
+  }
+
+  SECTION("ext 32") {
+    std::string data(65536, 'x');
+    checkVariant(MsgPackExtension(3, data.data(), data.size()),
+                 std::string("\xC9\x00\x01\x00\x00\x03", 6) + data);
+  }
+}
+
+TEST_CASE("serialize MsgPack timestamp") {
+  SECTION("timestamp 32") {
+    checkVariant(MsgPackTimestamp(0x5f5e1000), "\xD6\xFF\x5F\x5E\x10\x00");
+  }
+
+  SECTION("timestamp 64") {
+    checkVariant(MsgPackTimestamp(1, 1),
+                 "\xD7\xFF\x00\x00\x00\x04\x00\x00\x00\x01", 10);
+  }
+
+  SECTION("timestamp 96") {
+    checkVariant(MsgPackTimestamp(-2, 2),
+                 "\xC7\x0C\xFF\x00\x00\x00\x02\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFE",
+                 15);
+  }
+}
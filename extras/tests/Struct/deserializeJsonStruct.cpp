@@ -0,0 +1,231 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string.h>
+
+#include <sstream>
+#include <string>
+
+namespace {
+
+enum Mode { Off, Auto, On };
+
+struct Point {
+  int x;
+  int y;
+};
+
+template <typename TFields>
+void jsonFields(Point& point, TFields& fields) {
+  fields("x", point.x);
+  fields("y", point.y);
+}
+
+struct Config {
+  char host[8];
+  std::string name;
+  unsigned short port;
+  bool enabled;
+  double ratio;
+  Mode mode;
+  Point origin;
+  Point path[2];
+  long values[3];
+};
+
+template <typename TFields>
+void jsonFields(Config& config, TFields& fields) {
+  fields("host", config.host);
+  fields("name", config.name);
+  fields("port", config.port);
+  fields("enabled", config.enabled);
+  fields("ratio", config.ratio);
+  fields("mode", config.mode);
+  fields("origin", config.origin);
+  fields("path", config.path);
+  fields("values", config.values);
+}
+
+Config defaultConfig() {
+  Config config;
+  strcpy(config.host, "none");
+  config.name = "default";
+  config.port = 80;
+  config.enabled = false;
+  config.ratio = 0.5;
+  config.mode = Off;
+  config.origin.x = 1;
+  config.origin.y = 2;
+  config.path[0] = config.path[1] = config.origin;
+  config.values[0] = config.values[1] = config.values[2] = 9;
+  return config;
+}
+
+}  // namespace
+
+TEST_CASE("deserializeJsonStruct()") {
+  Config config = defaultConfig();
+
+  SECTION("all fields") {
+    DeserializationError err = deserializeJsonStruct(
+        config,
+        "{\"host\":\"local\",\"name\":\"test\",\"port\":8080,\"enabled\":true,"
+        "\"ratio\":1.5,\"mode\":2,\"origin\":{\"x\":3,\"y\":4},"
+        "\"path\":[{\"x\":5},{\"y\":6}],\"values\":[7,8,9,10]}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(std::string(config.host) == "local");
+    REQUIRE(config.name == "test");
+    REQUIRE(config.port == 8080);
+    REQUIRE(config.enabled == true);
+    REQUIRE(config.ratio == 1.5);
+    REQUIRE(config.mode == On);
+    REQUIRE(config.origin.x == 3);
+    REQUIRE(config.origin.y == 4);
+    REQUIRE(config.path[0].x == 5);
+    REQUIRE(config.path[0].y == 2);
+    REQUIRE(config.path[1].x == 1);
+    REQUIRE(config.path[1].y == 6);
+    REQUIRE(config.values[0] == 7);
+    REQUIRE(config.values[1] == 8);
+    REQUIRE(config.values[2] == 9);
+  }
+
+  SECTION("missing keys keep the default value") {
+    DeserializationError err = deserializeJsonStruct(config, "{\"port\":1}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(config.port == 1);
+    REQUIRE(std::string(config.host) == "none");
+    REQUIRE(config.name == "default");
+    REQUIRE(config.origin.x == 1);
+  }
+
+  SECTION("skips unknown keys") {
+    DeserializationError err = deserializeJsonStruct(
+        config,
+        "{\"extra\":{\"port\":1,\"a\":[1,{}]},\"port\":2,\"portal\":3,"
+        "\"por\":4}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(config.port == 2);
+  }
+
+  SECTION("skips keys longer than the internal buffer") {
+    std::string key(100, 'k');
+    std::string json = "{\"" + key + "\":1,\"port\":2}";
+
+    DeserializationError err = deserializeJsonStruct(config, json);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(config.port == 2);
+  }
+
+  SECTION("the last duplicate wins") {
+    deserializeJsonStruct(config, "{\"port\":1,\"port\":2}");
+
+    REQUIRE(config.port == 2);
+  }
+
+  SECTION("converts values like as<T>()") {
+    DeserializationError err = deserializeJsonStruct(
+        config,
+        "{\"port\":\"42\",\"enabled\":1,\"ratio\":null,\"mode\":[1],"
+        "\"name\":42,\"host\":{}}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(config.port == 42);
+    REQUIRE(config.enabled == true);
+    REQUIRE(config.ratio == 0);
+    REQUIRE(config.mode == Off);
+    REQUIRE(config.name == "42");
+    REQUIRE(std::string(config.host) == "");
+  }
+
+  SECTION("serializes a value that isn't a string, like as<std::string>()") {
+    DeserializationError err = deserializeJsonStruct(
+        config, "{\"name\": [ true, null, 0.5, { k : 'a\\\"b' }, [] ]}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(config.name == "[true,null,0.5,{\"k\":\"a\\\"b\"},[]]");
+  }
+
+  SECTION("skips a value that isn't an object or an array") {
+    DeserializationError err =
+        deserializeJsonStruct(config, "{\"origin\":42,\"values\":\"x\"}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(config.origin.x == 1);
+    REQUIRE(config.values[0] == 9);
+  }
+
+  SECTION("unicode escapes") {
+    deserializeJsonStruct(config, "{\"name\":\"caf\\u00e9\"}");
+
+    REQUIRE(config.name == "caf\xC3\xA9");
+  }
+
+  SECTION("NoMemory when the string doesn't fit in the char array") {
+    REQUIRE(deserializeJsonStruct(config, "{\"host\":\"1234567\"}") ==
+            DeserializationError::Ok);
+    REQUIRE(deserializeJsonStruct(config, "{\"host\":\"12345678\"}") ==
+            DeserializationError::NoMemory);
+  }
+
+  SECTION("std::istream") {
+    std::istringstream input("{\"port\":12} ");
+
+    DeserializationError err = deserializeJsonStruct(config, input);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(config.port == 12);
+  }
+
+  SECTION("char* and size") {
+    char input[] = "{\"port\":12}";
+
+    DeserializationError err = deserializeJsonStruct(config, input, 9);
+
+    REQUIRE(err == DeserializationError::IncompleteInput);
+  }
+
+  SECTION("EmptyInput") {
+    REQUIRE(deserializeJsonStruct(config, " ") ==
+            DeserializationError::EmptyInput);
+  }
+
+  SECTION("IncompleteInput") {
+    REQUIRE(deserializeJsonStruct(config, "{\"port\":1,") ==
+            DeserializationError::IncompleteInput);
+    REQUIRE(deserializeJsonStruct(config, "{\"name\":\"abc") ==
+            DeserializationError::IncompleteInput);
+  }
+
+  SECTION("InvalidInput") {
+    REQUIRE(deserializeJsonStruct(config, "{\"port\" 1}") ==
+            DeserializationError::InvalidInput);
+    REQUIRE(deserializeJsonStruct(config, "{\"values\":[1;2]}") ==
+            DeserializationError::InvalidInput);
+    REQUIRE(deserializeJsonStruct(config, "42 x") ==
+            DeserializationError::InvalidInput);
+  }
+
+  SECTION("TooDeep") {
+    REQUIRE(deserializeJsonStruct(config, "{\"origin\":{}}",
+                                  DeserializationOption::NestingLimit(1)) ==
+            DeserializationError::TooDeep);
+    REQUIRE(deserializeJsonStruct(config, "{\"extra\":[[]]}",
+                                  DeserializationOption::NestingLimit(2)) ==
+            DeserializationError::TooDeep);
+    REQUIRE(deserializeJsonStruct(config, "{\"name\":[[]]}",
+                                  DeserializationOption::NestingLimit(2)) ==
+            DeserializationError::TooDeep);
+    REQUIRE(deserializeJsonStruct(config, "{\"origin\":{}}",
+                                  DeserializationOption::NestingLimit(2)) ==
+            DeserializationError::Ok);
+  }
+}
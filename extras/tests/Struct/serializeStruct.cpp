@@ -0,0 +1,193 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string.h>
+
+#include <sstream>
+#include <string>
+
+namespace {
+
+enum Mode { Off, Auto, On };
+
+struct Point {
+  int x;
+  int y;
+};
+
+template <typename TFields>
+void jsonFields(Point& point, TFields& fields) {
+  fields("x", point.x);
+  fields("y", point.y);
+}
+
+struct Message {
+  char id[4];
+  std::string text;
+  unsigned long size;
+  bool urgent;
+  float ratio;
+  Mode mode;
+  Point path[2];
+};
+
+template <typename TFields>
+void jsonFields(Message& message, TFields& fields) {
+  fields("id", message.id);
+  fields("text", message.text);
+  fields("size", message.size);
+  fields("urgent", message.urgent);
+  fields("ratio", message.ratio);
+  fields("mode", message.mode);
+  fields("path", message.path);
+}
+
+Message sampleMessage() {
+  Message message;
+  strcpy(message.id, "m1");
+  message.text = "say \"hi\"";
+  message.size = 4000000000UL;
+  message.urgent = true;
+  message.ratio = 0.5f;
+  message.mode = Auto;
+  message.path[0].x = 1;
+  message.path[0].y = -2;
+  message.path[1].x = 300;
+  message.path[1].y = 70000;
+  return message;
+}
+
+struct Quoted {
+  int value;
+};
+
+template <typename TFields>
+void jsonFields(Quoted& quoted, TFields& fields) {
+  fields("say \"hi\"", quoted.value);
+}
+
+// The same content in a JsonDocument
+void fillDocument(JsonDocument& doc, const Message& message) {
+  doc["id"] = message.id;
+  doc["text"] = message.text;
+  doc["size"] = message.size;
+  doc["urgent"] = message.urgent;
+  doc["ratio"] = message.ratio;
+  doc["mode"] = static_cast<int>(message.mode);
+  for (int i = 0; i < 2; i++) {
+    JsonObject point = doc["path"].createNestedObject();
+    point["x"] = message.path[i].x;
+    point["y"] = message.path[i].y;
+  }
+}
+
+}  // namespace
+
+TEST_CASE("serializeJsonStruct()") {
+  Message message = sampleMessage();
+  DynamicJsonDocument doc(1024);
+  fillDocument(doc, message);
+  std::string expected;
+  serializeJson(doc, expected);
+
+  SECTION("same output as serializeJson()") {
+    std::string output;
+
+    size_t n = serializeJsonStruct(message, output);
+
+    REQUIRE(output == expected);
+    REQUIRE(n == expected.size());
+    REQUIRE(measureJsonStruct(message) == expected.size());
+  }
+
+  SECTION("std::ostream") {
+    std::ostringstream os;
+
+    serializeJsonStruct(message, os);
+
+    REQUIRE(os.str() == expected);
+  }
+
+  SECTION("char array without terminator") {
+    memcpy(message.id, "abcd", 4);
+    std::string output;
+
+    serializeJsonStruct(message, output);
+
+    REQUIRE(output.find("{\"id\":\"abcd\",") == 0);
+  }
+
+  SECTION("buffer") {
+    char buffer[16];
+
+    size_t n = serializeJsonStruct(message, buffer, sizeof(buffer));
+
+    REQUIRE(n == 16);
+    REQUIRE(std::string(buffer, n) == expected.substr(0, 16));
+  }
+
+  SECTION("buffer is null-terminated") {
+    Point point = {1, 2};
+    char buffer[32];
+
+    size_t n = serializeJsonStruct(point, buffer, sizeof(buffer));
+
+    REQUIRE(n == 13);
+    REQUIRE(std::string(buffer) == "{\"x\":1,\"y\":2}");
+  }
+
+  SECTION("escapes the keys") {
+    Quoted quoted = {1};
+    std::string output;
+
+    serializeJsonStruct(quoted, output);
+
+    REQUIRE(output == "{\"say \\\"hi\\\"\":1}");
+    REQUIRE(measureJsonStruct(quoted) == output.size());
+  }
+
+  SECTION("round trip through deserializeJsonStruct()") {
+    std::string json;
+    serializeJsonStruct(message, json);
+    Message copy = Message();
+
+    DeserializationError err = deserializeJsonStruct(copy, json);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(std::string(copy.id) == "m1");
+    REQUIRE(copy.text == message.text);
+    REQUIRE(copy.size == message.size);
+    REQUIRE(copy.mode == Auto);
+    REQUIRE(copy.path[1].y == 70000);
+  }
+}
+
+TEST_CASE("serializeMsgPackStruct()") {
+  Message message = sampleMessage();
+  DynamicJsonDocument doc(1024);
+  fillDocument(doc, message);
+  std::string expected;
+  serializeMsgPack(doc, expected);
+
+  SECTION("same output as serializeMsgPack()") {
+    std::string output;
+
+    size_t n = serializeMsgPackStruct(message, output);
+
+    REQUIRE(output == expected);
+    REQUIRE(n == expected.size());
+    REQUIRE(measureMsgPackStruct(message) == expected.size());
+  }
+
+  SECTION("buffer") {
+    char buffer[128];
+
+    size_t n = serializeMsgPackStruct(message, buffer, sizeof(buffer));
+
+    REQUIRE(std::string(buffer, n) == expected);
+  }
+}
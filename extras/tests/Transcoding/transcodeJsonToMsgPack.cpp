@@ -0,0 +1,149 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <sstream>
+#include <string>
+
+// Compares with the output of deserializeJson() + serializeMsgPack()
+static void check(const std::string& json) {
+  DynamicJsonDocument doc(65536);
+  REQUIRE(deserializeJson(doc, json) == DeserializationError::Ok);
+  std::string expected;
+  serializeMsgPack(doc, expected);
+
+  std::string actual;
+  DeserializationError err = transcodeJsonToMsgPack(json, actual);
+
+  REQUIRE(err == DeserializationError::Ok);
+  REQUIRE(actual == expected);
+}
+
+static std::string repeat(const std::string& s, size_t n) {
+  std::string result;
+  while (n--)
+    result += s;
+  return result;
+}
+
+TEST_CASE("transcodeJsonToMsgPack()") {
+  std::string output;
+
+  SECTION("scalars") {
+    check("null");
+    check("true");
+    check("false");
+    check("42");
+    check("-42");
+    check("-129");
+    check("65536");
+    check("3.14");
+    check("\"hello\"");
+  }
+
+  SECTION("escape sequences") {
+    check("\"a\\\"b\\\\c\\nd\\u00e9\"");
+  }
+
+  SECTION("unquoted keys and single quotes") {
+    check("{hello:'world'}");
+  }
+
+  SECTION("nested containers") {
+    check("{\"a\":[1,[2,{}],{\"b\":[]}],\"c\":{\"d\":null}}");
+  }
+
+  SECTION("str8 and str16") {
+    check("\"" + repeat("x", 31) + "\"");
+    check("\"" + repeat("x", 32) + "\"");
+    check("\"" + repeat("x", 256) + "\"");
+    check("{\"" + repeat("k", 300) + "\":1}");
+  }
+
+  SECTION("array16 and map16") {
+    check("[" + repeat("1,", 15) + "1]");
+    check("[" + repeat("[1,2],", 20) + "\"" + repeat("x", 40) + "\"]");
+
+    std::string json = "{";
+    for (int i = 0; i < 20; i++) {
+      json += "\"";
+      json += char('a' + i);
+      json += "\":[0],";
+    }
+    json += "\"z\":0}";
+    check(json);
+  }
+
+  SECTION("appends to the output") {
+    output = "\x01";
+
+    transcodeJsonToMsgPack("[1]", output);
+
+    REQUIRE(output == "\x01\x91\x01");
+  }
+
+  SECTION("restores the output on error") {
+    output = "\x01";
+
+    DeserializationError err = transcodeJsonToMsgPack("[1,{\"a\":", output);
+
+    REQUIRE(err == DeserializationError::IncompleteInput);
+    REQUIRE(output == "\x01");
+  }
+
+  SECTION("keeps duplicate keys") {
+    transcodeJsonToMsgPack("{\"a\":1,\"a\":2}", output);
+
+    REQUIRE(output == "\x82\xA1" "a" "\x01\xA1" "a" "\x02");
+  }
+
+  SECTION("std::istream") {
+    std::istringstream input("{\"a\":[1,2]} ");
+
+    DeserializationError err = transcodeJsonToMsgPack(input, output);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(output == "\x81\xA1" "a" "\x92\x01\x02");
+  }
+
+  SECTION("char* and size") {
+    char input[] = "[1,2]";
+
+    DeserializationError err = transcodeJsonToMsgPack(input, 3, output);
+
+    REQUIRE(err == DeserializationError::IncompleteInput);
+  }
+
+  SECTION("EmptyInput") {
+    REQUIRE(transcodeJsonToMsgPack(" ", output) ==
+            DeserializationError::EmptyInput);
+  }
+
+  SECTION("IncompleteInput") {
+    REQUIRE(transcodeJsonToMsgPack("{\"a\":[1,", output) ==
+            DeserializationError::IncompleteInput);
+    REQUIRE(transcodeJsonToMsgPack("\"hello", output) ==
+            DeserializationError::IncompleteInput);
+  }
+
+  SECTION("InvalidInput") {
+    REQUIRE(transcodeJsonToMsgPack("[1;2]", output) ==
+            DeserializationError::InvalidInput);
+    REQUIRE(transcodeJsonToMsgPack("{\"a\" 1}", output) ==
+            DeserializationError::InvalidInput);
+    REQUIRE(transcodeJsonToMsgPack("42 x", output) ==
+            DeserializationError::InvalidInput);
+  }
+
+  SECTION("TooDeep") {
+    REQUIRE(transcodeJsonToMsgPack("[[1]]", output,
+                                   DeserializationOption::NestingLimit(1)) ==
+            DeserializationError::TooDeep);
+    REQUIRE(transcodeJsonToMsgPack("[[1]]", output,
+                                   DeserializationOption::NestingLimit(2)) ==
+            DeserializationError::Ok);
+  }
+}
@@ -0,0 +1,110 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <sstream>
+#include <string>
+
+// Compares with the output of deserializeMsgPack() + serializeJson()
+static void check(const std::string& msgpack) {
+  DynamicJsonDocument doc(65536);
+  REQUIRE(deserializeMsgPack(doc, msgpack) == DeserializationError::Ok);
+  std::string expected;
+  serializeJson(doc, expected);
+
+  std::string actual;
+  DeserializationError err = transcodeMsgPackToJson(msgpack, actual);
+
+  REQUIRE(err == DeserializationError::Ok);
+  REQUIRE(actual == expected);
+}
+
+TEST_CASE("transcodeMsgPackToJson()") {
+  std::string output;
+
+  SECTION("scalars") {
+    check("\xC0");
+    check("\xC2");
+    check("\xC3");
+    check("\x2A");
+    check("\xE0");
+    check("\xCC\xFF");
+    check(std::string("\xD1\xFF\x00", 3));
+    check("\xCE\x12\x34\x56\x78");
+    check("\xCA\x40\x48\xF5\xC3");
+    check("\xCB\x40\x09\x21\xFB\x54\x44\x2D\x18");
+  }
+
+  SECTION("strings") {
+    check("\xA5hello");
+    check(std::string("\xA3" "a\"\0", 4));
+    check("\xD9\x05world");
+    check(std::string("\xDA\x00\x40", 3) + std::string(64, 'x'));
+  }
+
+  SECTION("binary and extension") {
+    check("\xC4\x03\x01\x02\x03");
+    check(std::string("\xC5\x00\x64", 3) + std::string(100, '\x42'));
+    check("\xD6\xFF\x01\x02\x03\x04");
+    check("\xC7\x02\x01\x0A\x0B");
+  }
+
+  SECTION("nested containers") {
+    check("\x82\xA1" "a" "\x93\x01\x90\x80\xA1" "b" "\x81\xA1" "c" "\xC0");
+    check(std::string("\xDC\x00\x02\x01\x02", 5));
+    check(std::string("\xDE\x00\x01\xA1" "a" "\x01", 6));
+  }
+
+  SECTION("std::ostream") {
+    std::ostringstream os;
+
+    DeserializationError err = transcodeMsgPackToJson("\x92\x01\xA1x", os);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(os.str() == "[1,\"x\"]");
+  }
+
+  SECTION("std::istream") {
+    std::istringstream input("\x81\xA1" "a" "\x2A");
+
+    DeserializationError err = transcodeMsgPackToJson(input, output);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(output == "{\"a\":42}");
+  }
+
+  SECTION("char* and size") {
+    char input[] = "\x92\x01\x02";
+
+    DeserializationError err = transcodeMsgPackToJson(input, 2, output);
+
+    REQUIRE(err == DeserializationError::IncompleteInput);
+    REQUIRE(output == "[1,");
+  }
+
+  SECTION("EmptyInput") {
+    REQUIRE(transcodeMsgPackToJson(std::string(), output) ==
+            DeserializationError::EmptyInput);
+  }
+
+  SECTION("IncompleteInput") {
+    REQUIRE(transcodeMsgPackToJson(std::string("\xA5hel"), output) ==
+            DeserializationError::IncompleteInput);
+  }
+
+  SECTION("InvalidInput") {
+    REQUIRE(transcodeMsgPackToJson("\xC1", output) ==
+            DeserializationError::InvalidInput);
+    REQUIRE(transcodeMsgPackToJson(std::string("\x81\x01\x02"), output) ==
+            DeserializationError::InvalidInput);
+  }
+
+  SECTION("TooDeep") {
+    REQUIRE(transcodeMsgPackToJson("\x91\x91\x01", output,
+                                   DeserializationOption::NestingLimit(1)) ==
+            DeserializationError::TooDeep);
+  }
+}
@@ -27,6 +27,7 @@
 
 #include "ArduinoJson/Document/DynamicJsonDocument.hpp"
 #include "ArduinoJson/Document/StaticJsonDocument.hpp"
+#include "ArduinoJson/Strings/JsonKey.hpp"
 
 #include "ArduinoJson/Array/ArrayImpl.hpp"
 #include "ArduinoJson/Array/ElementProxy.hpp"
@@ -38,11 +39,37 @@
 #include "ArduinoJson/Variant/VariantCompare.hpp"
 #include "ArduinoJson/Variant/VariantImpl.hpp"
 
+#include "ArduinoJson/Cbor/CborDeserializer.hpp"
+#include "ArduinoJson/Cbor/CborSerializer.hpp"
+#include "ArduinoJson/Json/JsonArrayStream.hpp"
 #include "ArduinoJson/Json/JsonDeserializer.hpp"
+#include "ArduinoJson/Json/JsonObjectStream.hpp"
+#include "ArduinoJson/Json/JsonReparser.hpp"
 #include "ArduinoJson/Json/JsonSerializer.hpp"
+#include "ArduinoJson/Json/JsonStreamWriter.hpp"
 #include "ArduinoJson/Json/PrettyJsonSerializer.hpp"
+#include "ArduinoJson/MsgPack/MsgPackBinary.hpp"
 #include "ArduinoJson/MsgPack/MsgPackDeserializer.hpp"
 #include "ArduinoJson/MsgPack/MsgPackSerializer.hpp"
+#include "ArduinoJson/MsgPack/MsgPackStreamWriter.hpp"
+#include "ArduinoJson/Patch/applyJsonPatch.hpp"
+#include "ArduinoJson/Patch/diffJson.hpp"
+#include "ArduinoJson/Patch/mergeJsonPatch.hpp"
+
+#if ARDUINOJSON_ENABLE_SHARED_DOCUMENT
+#  include "ArduinoJson/Document/SharedJsonDocument.hpp"
+#endif
+
+#include "ArduinoJson/Image/deserializeImage.hpp"
+#include "ArduinoJson/Image/jsonLiteral.hpp"
+#include "ArduinoJson/Image/serializeImage.hpp"
+
+#include "ArduinoJson/Struct/JsonStructDeserializer.hpp"
+#include "ArduinoJson/Struct/JsonStructSerializer.hpp"
+#include "ArduinoJson/Struct/MsgPackStructSerializer.hpp"
+
+#include "ArduinoJson/Transcoding/transcodeJsonToMsgPack.hpp"
+#include "ArduinoJson/Transcoding/transcodeMsgPackToJson.hpp"
 
 #include "ArduinoJson/compatibility.hpp"
 
@@ -60,18 +87,68 @@ typedef ARDUINOJSON_NAMESPACE::UInt JsonUInt;
 typedef ARDUINOJSON_NAMESPACE::VariantConstRef JsonVariantConst;
 typedef ARDUINOJSON_NAMESPACE::VariantRef JsonVariant;
 using ARDUINOJSON_NAMESPACE::BasicJsonDocument;
+#if ARDUINOJSON_ENABLE_SHARED_DOCUMENT
+using ARDUINOJSON_NAMESPACE::BasicJsonDocumentPublisher;
+using ARDUINOJSON_NAMESPACE::BasicSharedJsonDocument;
+#endif
+using ARDUINOJSON_NAMESPACE::applyJsonPatch;
 using ARDUINOJSON_NAMESPACE::copyArray;
 using ARDUINOJSON_NAMESPACE::DeserializationError;
+using ARDUINOJSON_NAMESPACE::deserializeCbor;
+using ARDUINOJSON_NAMESPACE::deserializeImage;
 using ARDUINOJSON_NAMESPACE::deserializeJson;
+using ARDUINOJSON_NAMESPACE::deserializeJsonStruct;
 using ARDUINOJSON_NAMESPACE::deserializeMsgPack;
+using ARDUINOJSON_NAMESPACE::diffJson;
 using ARDUINOJSON_NAMESPACE::DynamicJsonDocument;
+using ARDUINOJSON_NAMESPACE::JsonArrayStream;
 using ARDUINOJSON_NAMESPACE::JsonDocument;
+#if ARDUINOJSON_ENABLE_SHARED_DOCUMENT
+using ARDUINOJSON_NAMESPACE::JsonDocumentPublisher;
+#endif
+using ARDUINOJSON_NAMESPACE::JsonKey;
+using ARDUINOJSON_NAMESPACE::JsonKeyDictionary;
+#if ARDUINOJSON_HAS_CONSTEVAL
+using ARDUINOJSON_NAMESPACE::jsonLiteral;
+using ARDUINOJSON_NAMESPACE::jsonLiteralImage;
+#endif
+using ARDUINOJSON_NAMESPACE::JsonObjectStream;
+using ARDUINOJSON_NAMESPACE::JsonStreamWriter;
+#if ARDUINOJSON_ENABLE_SHARED_DOCUMENT
+using ARDUINOJSON_NAMESPACE::linkMembers;
+#endif
+#if ARDUINOJSON_ENABLE_MMAP
+using ARDUINOJSON_NAMESPACE::MappedFile;
+#endif
+using ARDUINOJSON_NAMESPACE::mergeJsonPatch;
+using ARDUINOJSON_NAMESPACE::measureImage;
 using ARDUINOJSON_NAMESPACE::measureJson;
+using ARDUINOJSON_NAMESPACE::measureJsonStruct;
+using ARDUINOJSON_NAMESPACE::measureMsgPackStruct;
+using ARDUINOJSON_NAMESPACE::MsgPackBinary;
+using ARDUINOJSON_NAMESPACE::MsgPackExtension;
+using ARDUINOJSON_NAMESPACE::MsgPackStreamWriter;
+using ARDUINOJSON_NAMESPACE::MsgPackTimestamp;
+using ARDUINOJSON_NAMESPACE::reparseJson;
+using ARDUINOJSON_NAMESPACE::serializeCbor;
 using ARDUINOJSON_NAMESPACE::serialized;
+using ARDUINOJSON_NAMESPACE::serializeImage;
 using ARDUINOJSON_NAMESPACE::serializeJson;
+using ARDUINOJSON_NAMESPACE::serializeJsonStruct;
 using ARDUINOJSON_NAMESPACE::serializeJsonPretty;
 using ARDUINOJSON_NAMESPACE::serializeMsgPack;
+using ARDUINOJSON_NAMESPACE::serializeMsgPackStruct;
+#if ARDUINOJSON_ENABLE_SHARED_DOCUMENT
+using ARDUINOJSON_NAMESPACE::SharedJsonDocument;
+#endif
 using ARDUINOJSON_NAMESPACE::StaticJsonDocument;
+using ARDUINOJSON_NAMESPACE::streamJsonArray;
+using ARDUINOJSON_NAMESPACE::streamJsonObject;
+#if ARDUINOJSON_ENABLE_STD_STRING
+using ARDUINOJSON_NAMESPACE::transcodeJsonToMsgPack;
+#endif
+using ARDUINOJSON_NAMESPACE::transcodeMsgPackToJson;
+using ARDUINOJSON_NAMESPACE::viewImage;
 
 namespace DeserializationOption {
 using ARDUINOJSON_NAMESPACE::Filter;
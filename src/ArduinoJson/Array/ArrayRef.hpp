@@ -47,6 +47,10 @@ class ArrayRefBase {
     return variantNesting(getVariantData());
   }
 
+  FORCE_INLINE uint32_t hash() const {
+    return variantHash(getVariantData());
+  }
+
   FORCE_INLINE size_t size() const {
     return _data ? _data->size() : 0;
   }
@@ -0,0 +1,646 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Cbor/CborMajorType.hpp>
+#include <ArduinoJson/Cbor/ieee754.hpp>
+#include <ArduinoJson/Deserialization/deserialize.hpp>
+#include <ArduinoJson/Memory/MemoryPool.hpp>
+#include <ArduinoJson/MsgPack/endianess.hpp>
+#include <ArduinoJson/MsgPack/ieee754.hpp>
+#include <ArduinoJson/Polyfills/limits.hpp>
+#include <ArduinoJson/Polyfills/type_traits.hpp>
+#include <ArduinoJson/Variant/VariantData.hpp>
+
+namespace ARDUINOJSON_NAMESPACE {
+
+template <typename TReader, typename TStringStorage>
+class CborDeserializer {
+  static const uint8_t indefiniteLength = 31;
+  static const uint8_t breakCode = 0xFF;
+
+ public:
+  CborDeserializer(MemoryPool &pool, TReader reader,
+                   TStringStorage stringStorage)
+      : _pool(&pool),
+        _reader(reader),
+        _stringStorage(stringStorage),
+        _error(DeserializationError::Ok),
+        _foundSomething(false) {}
+
+  template <typename TFilter>
+  DeserializationError parse(VariantData &variant, TFilter filter,
+                             NestingLimit nestingLimit) {
+    parseVariant(&variant, filter, nestingLimit);
+    return _foundSomething ? _error : DeserializationError::EmptyInput;
+  }
+
+ private:
+  bool invalidInput() {
+    _error = DeserializationError::InvalidInput;
+    return false;
+  }
+
+  bool noMemory() {
+    _error = DeserializationError::NoMemory;
+    return false;
+  }
+
+  template <typename TFilter>
+  bool parseVariant(VariantData *variant, TFilter filter,
+                    NestingLimit nestingLimit) {
+    uint8_t code = 0;
+    if (!readByte(code))
+      return false;
+
+    _foundSomething = true;
+
+    return parseVariant(code, variant, filter, nestingLimit);
+  }
+
+  template <typename TFilter>
+  bool parseVariant(uint8_t code, VariantData *variant, TFilter filter,
+                    NestingLimit nestingLimit) {
+    // tags only add semantics to the following item, we ignore them, except
+    // the one of MessagePack's ext (see CBOR_EXTENSION_TAG_BASE)
+    uint64_t tag = 0;
+    while ((code & 0xE0) == CBOR_TAG) {
+      if (!readArgument(code, tag))
+        return false;
+      if (!readByte(code))
+        return false;
+    }
+
+    bool allowValue = filter.allowValue();
+
+    if (allowValue) {
+      // callers pass a null pointer only when value must be ignored
+      ARDUINOJSON_ASSERT(variant != 0);
+    }
+
+    switch (code & 0xE0) {
+      case CBOR_UNSIGNED_INTEGER:
+        if (allowValue)
+          return readUnsignedInteger(code, variant);
+        else
+          return skipArgument(code);
+
+      case CBOR_NEGATIVE_INTEGER:
+        if (allowValue)
+          return readNegativeInteger(code, variant);
+        else
+          return skipArgument(code);
+
+      case CBOR_BYTE_STRING:
+        if (!allowValue)
+          return skipString(code);
+        if (tag >= CBOR_EXTENSION_TAG_BASE &&
+            tag <= CBOR_EXTENSION_TAG_BASE + 0xFF)
+          return readExtension(code, uint8_t(tag - CBOR_EXTENSION_TAG_BASE),
+                               variant);
+        return readBinary(code, variant);
+
+      case CBOR_TEXT_STRING:
+        if (allowValue)
+          return readString(code, variant);
+        else
+          return skipString(code);
+
+      case CBOR_ARRAY:
+        return readArray(code, variant, filter, nestingLimit);
+
+      case CBOR_MAP:
+        return readObject(code, variant, filter, nestingLimit);
+
+      default:
+        return readSimpleValue(code, allowValue ? variant : 0);
+    }
+  }
+
+  bool readSimpleValue(uint8_t code, VariantData *variant) {
+    switch (code) {
+      case 0xF4:
+        if (variant)
+          variant->setBoolean(false);
+        return true;
+
+      case 0xF5:
+        if (variant)
+          variant->setBoolean(true);
+        return true;
+
+      case 0xF8:  // simple value in the next byte
+        return skipBytes(1);
+
+      case 0xF9:
+        if (variant)
+          return readHalf(variant);
+        else
+          return skipBytes(2);
+
+      case 0xFA:
+        if (variant)
+          return readFloat<float>(variant);
+        else
+          return skipBytes(4);
+
+      case 0xFB:
+        if (variant)
+          return readDouble<double>(variant);
+        else
+          return skipBytes(8);
+
+      case 0xFC:
+      case 0xFD:
+      case 0xFE:
+      case breakCode:  // outside of an indefinite-length item
+        return invalidInput();
+
+      default:
+        // null, undefined, and unassigned simple values
+        return true;
+    }
+  }
+
+  bool readByte(uint8_t &value) {
+    int c = _reader.read();
+    if (c < 0) {
+      _error = DeserializationError::IncompleteInput;
+      return false;
+    }
+    value = static_cast<uint8_t>(c);
+    return true;
+  }
+
+  bool readBytes(uint8_t *p, size_t n) {
+    if (_reader.readBytes(reinterpret_cast<char *>(p), n) == n)
+      return true;
+    _error = DeserializationError::IncompleteInput;
+    return false;
+  }
+
+  template <typename T>
+  bool readBytes(T &value) {
+    return readBytes(reinterpret_cast<uint8_t *>(&value), sizeof(value));
+  }
+
+  bool skipBytes(size_t n) {
+    if (_reader.skip(n) == n)
+      return true;
+    _error = DeserializationError::IncompleteInput;
+    return false;
+  }
+
+  template <typename T>
+  bool readInteger(T &value) {
+    if (!readBytes(value))
+      return false;
+    fixEndianess(value);
+    return true;
+  }
+
+  template <typename T>
+  bool readArgument(uint64_t &value) {
+    T n;
+    if (!readInteger(n))
+      return false;
+    value = n;
+    return true;
+  }
+
+  // Reads the integer that follows the initial byte
+  bool readArgument(uint8_t code, uint64_t &value) {
+    uint8_t info = code & 0x1F;
+    switch (info) {
+      case 24:
+        return readArgument<uint8_t>(value);
+      case 25:
+        return readArgument<uint16_t>(value);
+      case 26:
+        return readArgument<uint32_t>(value);
+      case 27:
+        return readArgument<uint64_t>(value);
+      default:
+        if (info >= 24)
+          return invalidInput();
+        value = info;
+        return true;
+    }
+  }
+
+  bool readLength(uint8_t code, size_t &value) {
+    uint64_t n;
+    if (!readArgument(code, n))
+      return false;
+    value = static_cast<size_t>(n);
+    if (value != n)  // doesn't fit in memory anyway
+      return noMemory();
+    return true;
+  }
+
+  bool skipArgument(uint8_t code) {
+    uint64_t value;
+    return readArgument(code, value);
+  }
+
+  bool readUnsignedInteger(uint8_t code, VariantData *variant) {
+    uint64_t value;
+    if (!readArgument(code, value))
+      return false;
+    if (value <= numeric_limits<UInt>::highest())  // else not supported
+      variant->setInteger(static_cast<UInt>(value));
+    return true;
+  }
+
+  bool readNegativeInteger(uint8_t code, VariantData *variant) {
+    uint64_t value;
+    if (!readArgument(code, value))
+      return false;
+    // the value is -1-n
+    if (value <= static_cast<UInt>(numeric_limits<Integer>::highest()))
+      variant->setInteger(-1 - static_cast<Integer>(value));
+    return true;
+  }
+
+  bool readHalf(VariantData *variant) {
+    uint16_t value;
+    if (!readInteger(value))
+      return false;
+    variant->setFloat(halfToFloat(value));
+    return true;
+  }
+
+  template <typename T>
+  bool readFloat(VariantData *variant) {
+    T value;
+    if (!readBytes(value))
+      return false;
+    fixEndianess(value);
+    variant->setFloat(value);
+    return true;
+  }
+
+  template <typename T>
+  typename enable_if<sizeof(T) == 8, bool>::type readDouble(
+      VariantData *variant) {
+    T value;
+    if (!readBytes(value))
+      return false;
+    fixEndianess(value);
+    variant->setFloat(value);
+    return true;
+  }
+
+  template <typename T>
+  typename enable_if<sizeof(T) == 4, bool>::type readDouble(
+      VariantData *variant) {
+    uint8_t i[8];  // input is 8 bytes
+    T value;       // output is 4 bytes
+    uint8_t *o = reinterpret_cast<uint8_t *>(&value);
+    if (!readBytes(i, 8))
+      return false;
+    doubleToFloat(i, o);
+    fixEndianess(value);
+    variant->setFloat(value);
+    return true;
+  }
+
+  bool readString(uint8_t code, VariantData *variant) {
+    if (!readString(code))
+      return false;
+    variant->setString(_stringStorage.save());
+    return true;
+  }
+
+  bool readBinary(uint8_t code, VariantData *variant) {
+    if (!readString(code))
+      return false;
+    variant->setBinary(_stringStorage.save());
+    return true;
+  }
+
+  // The type code is stored just before the data, like in
+  // MsgPackDeserializer
+  bool readExtension(uint8_t code, uint8_t type, VariantData *variant) {
+    _stringStorage.startString();
+    char *p = _stringStorage.reserve(1);
+    if (!p) {
+      // consume the input anyway, to report IncompleteInput if relevant
+      if (!skipString(code))
+        return false;
+      return noMemory();
+    }
+    *p = static_cast<char>(type);
+    if (!appendString(code))
+      return false;
+    variant->setExtension(_stringStorage.save());
+    return true;
+  }
+
+  // Reads a text or a byte string in _stringStorage.
+  bool readString(uint8_t code) {
+    _stringStorage.startString();
+    return appendString(code);
+  }
+
+  // An indefinite-length string is the concatenation of its chunks.
+  bool appendString(uint8_t code) {
+    if ((code & 0x1F) != indefiniteLength)
+      return readStringChunk(code);
+
+    for (;;) {
+      uint8_t chunkCode;
+      if (!readByte(chunkCode))
+        return false;
+      if (chunkCode == breakCode)
+        return true;
+      // chunks must be definite-length strings of the same major type
+      if ((chunkCode & 0xE0) != (code & 0xE0) ||
+          (chunkCode & 0x1F) == indefiniteLength)
+        return invalidInput();
+      if (!readStringChunk(chunkCode))
+        return false;
+    }
+  }
+
+  bool readStringChunk(uint8_t code) {
+    size_t n;
+    if (!readLength(code, n))
+      return false;
+    char *p = _stringStorage.reserve(n);
+    if (!p) {
+      // consume the input anyway, to report IncompleteInput if relevant
+      if (!skipBytes(n))
+        return false;
+      return noMemory();
+    }
+    return readBytes(reinterpret_cast<uint8_t *>(p), n);
+  }
+
+  bool skipString(uint8_t code) {
+    if ((code & 0x1F) != indefiniteLength)
+      return skipStringChunk(code);
+
+    for (;;) {
+      uint8_t chunkCode;
+      if (!readByte(chunkCode))
+        return false;
+      if (chunkCode == breakCode)
+        return true;
+      if ((chunkCode & 0xE0) != (code & 0xE0) ||
+          (chunkCode & 0x1F) == indefiniteLength)
+        return invalidInput();
+      if (!skipStringChunk(chunkCode))
+        return false;
+    }
+  }
+
+  bool skipStringChunk(uint8_t code) {
+    size_t n;
+    if (!readLength(code, n))
+      return false;
+    return skipBytes(n);
+  }
+
+  // Reads the size of an array or a map; returns false on error.
+  // Sets "indefinite" if the size is unknown and items end with a break.
+  bool readCollectionSize(uint8_t code, size_t &n, bool &indefinite) {
+    indefinite = (code & 0x1F) == indefiniteLength;
+    if (indefinite)
+      return true;
+    return readLength(code, n);
+  }
+
+  // Reads the initial byte of the next item of a collection.
+  // Returns false at the end of the collection, or on error.
+  bool nextItem(uint8_t &code, size_t &remaining, bool indefinite) {
+    if (!indefinite) {
+      if (remaining == 0)
+        return false;
+      --remaining;
+    }
+    if (!readByte(code))
+      return false;
+    return !indefinite || code != breakCode;
+  }
+
+  template <typename TFilter>
+  bool readArray(uint8_t code, VariantData *variant, TFilter filter,
+                 NestingLimit nestingLimit) {
+    if (nestingLimit.reached()) {
+      _error = DeserializationError::TooDeep;
+      return false;
+    }
+
+    size_t n = 0;
+    bool indefinite;
+    if (!readCollectionSize(code, n, indefinite))
+      return false;
+
+    bool allowArray = filter.allowArray();
+
+    CollectionData *array = allowArray ? &variant->toArray() : 0;
+
+    TFilter memberFilter = filter[0U];
+
+    uint8_t itemCode;
+    while (nextItem(itemCode, n, indefinite)) {
+      VariantData *value;
+
+      if (memberFilter.allow()) {
+        value = array->addElement(_pool);
+        if (!value)
+          return noMemory();
+      } else {
+        value = 0;
+      }
+
+      if (!parseVariant(itemCode, value, memberFilter,
+                        nestingLimit.decrement()))
+        return false;
+    }
+
+    return _error == DeserializationError::Ok;
+  }
+
+  template <typename TFilter>
+  bool readObject(uint8_t code, VariantData *variant, TFilter filter,
+                  NestingLimit nestingLimit) {
+    if (nestingLimit.reached()) {
+      _error = DeserializationError::TooDeep;
+      return false;
+    }
+
+    size_t n = 0;
+    bool indefinite;
+    if (!readCollectionSize(code, n, indefinite))
+      return false;
+
+    CollectionData *object = filter.allowObject() ? &variant->toObject() : 0;
+
+    uint8_t keyCode;
+    while (nextItem(keyCode, n, indefinite)) {
+      if (!readKey(keyCode))
+        return false;
+
+      String key = _stringStorage.str();
+      TFilter memberFilter = filter[key.c_str()];
+      VariantData *member;
+
+      if (memberFilter.allow()) {
+        ARDUINOJSON_ASSERT(object);
+
+        // Save key in memory pool, unless it's in the key dictionary.
+        // This MUST be done before adding the slot.
+        key = _stringStorage.saveKey();
+
+        VariantSlot *slot = object->addSlot(_pool);
+        if (!slot)
+          return noMemory();
+
+        slot->setKey(key);
+
+        member = slot->data();
+      } else {
+        member = 0;
+      }
+
+      if (!parseVariant(member, memberFilter, nestingLimit.decrement()))
+        return false;
+    }
+
+    return _error == DeserializationError::Ok;
+  }
+
+  bool readKey(uint8_t code) {
+    while ((code & 0xE0) == CBOR_TAG) {
+      uint64_t tag;
+      if (!readArgument(code, tag))
+        return false;
+      if (!readByte(code))
+        return false;
+    }
+
+    if ((code & 0xE0) != CBOR_TEXT_STRING)
+      return invalidInput();  // only string keys are supported
+
+    return readString(code);
+  }
+
+  MemoryPool *_pool;
+  TReader _reader;
+  TStringStorage _stringStorage;
+  DeserializationError _error;
+  bool _foundSomething;
+};
+
+//
+// deserializeCbor(JsonDocument&, const std::string&, ...)
+//
+// ... = NestingLimit
+template <typename TString>
+DeserializationError deserializeCbor(
+    JsonDocument &doc, const TString &input,
+    NestingLimit nestingLimit = NestingLimit()) {
+  return deserialize<CborDeserializer>(doc, input, nestingLimit,
+                                       AllowAllFilter());
+}
+// ... = Filter, NestingLimit
+template <typename TString>
+DeserializationError deserializeCbor(
+    JsonDocument &doc, const TString &input, Filter filter,
+    NestingLimit nestingLimit = NestingLimit()) {
+  return deserialize<CborDeserializer>(doc, input, nestingLimit, filter);
+}
+// ... = NestingLimit, Filter
+template <typename TString>
+DeserializationError deserializeCbor(JsonDocument &doc, const TString &input,
+                                     NestingLimit nestingLimit,
+                                     Filter filter) {
+  return deserialize<CborDeserializer>(doc, input, nestingLimit, filter);
+}
+
+//
+// deserializeCbor(JsonDocument&, std::istream&, ...)
+//
+// ... = NestingLimit
+template <typename TStream>
+DeserializationError deserializeCbor(
+    JsonDocument &doc, TStream &input,
+    NestingLimit nestingLimit = NestingLimit()) {
+  return deserialize<CborDeserializer>(doc, input, nestingLimit,
+                                       AllowAllFilter());
+}
+// ... = Filter, NestingLimit
+template <typename TStream>
+DeserializationError deserializeCbor(
+    JsonDocument &doc, TStream &input, Filter filter,
+    NestingLimit nestingLimit = NestingLimit()) {
+  return deserialize<CborDeserializer>(doc, input, nestingLimit, filter);
+}
+// ... = NestingLimit, Filter
+template <typename TStream>
+DeserializationError deserializeCbor(JsonDocument &doc, TStream &input,
+                                     NestingLimit nestingLimit,
+                                     Filter filter) {
+  return deserialize<CborDeserializer>(doc, input, nestingLimit, filter);
+}
+
+//
+// deserializeCbor(JsonDocument&, char*, ...)
+//
+// ... = NestingLimit
+template <typename TChar>
+DeserializationError deserializeCbor(
+    JsonDocument &doc, TChar *input,
+    NestingLimit nestingLimit = NestingLimit()) {
+  return deserialize<CborDeserializer>(doc, input, nestingLimit,
+                                       AllowAllFilter());
+}
+// ... = Filter, NestingLimit
+template <typename TChar>
+DeserializationError deserializeCbor(
+    JsonDocument &doc, TChar *input, Filter filter,
+    NestingLimit nestingLimit = NestingLimit()) {
+  return deserialize<CborDeserializer>(doc, input, nestingLimit, filter);
+}
+// ... = NestingLimit, Filter
+template <typename TChar>
+DeserializationError deserializeCbor(JsonDocument &doc, TChar *input,
+                                     NestingLimit nestingLimit,
+                                     Filter filter) {
+  return deserialize<CborDeserializer>(doc, input, nestingLimit, filter);
+}
+
+//
+// deserializeCbor(JsonDocument&, char*, size_t, ...)
+//
+// ... = NestingLimit
+template <typename TChar>
+DeserializationError deserializeCbor(
+    JsonDocument &doc, TChar *input, size_t inputSize,
+    NestingLimit nestingLimit = NestingLimit()) {
+  return deserialize<CborDeserializer>(doc, input, inputSize, nestingLimit,
+                                       AllowAllFilter());
+}
+// ... = Filter, NestingLimit
+template <typename TChar>
+DeserializationError deserializeCbor(
+    JsonDocument &doc, TChar *input, size_t inputSize, Filter filter,
+    NestingLimit nestingLimit = NestingLimit()) {
+  return deserialize<CborDeserializer>(doc, input, inputSize, nestingLimit,
+                                       filter);
+}
+// ... = NestingLimit, Filter
+template <typename TChar>
+DeserializationError deserializeCbor(JsonDocument &doc, TChar *input,
+                                     size_t inputSize,
+                                     NestingLimit nestingLimit,
+                                     Filter filter) {
+  return deserialize<CborDeserializer>(doc, input, inputSize, nestingLimit,
+                                       filter);
+}
+
+}  // namespace ARDUINOJSON_NAMESPACE
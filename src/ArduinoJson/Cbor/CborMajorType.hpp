@@ -0,0 +1,31 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Namespace.hpp>
+
+#include <stdint.h>  // uint32_t
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// Major types of RFC 8949
+enum CborMajorType {
+  CBOR_UNSIGNED_INTEGER = 0x00,
+  CBOR_NEGATIVE_INTEGER = 0x20,
+  CBOR_BYTE_STRING = 0x40,
+  CBOR_TEXT_STRING = 0x60,
+  CBOR_ARRAY = 0x80,
+  CBOR_MAP = 0xA0,
+  CBOR_TAG = 0xC0,
+  CBOR_SIMPLE_OR_FLOAT = 0xE0
+};
+
+// CBOR has no equivalent of MessagePack's ext, so serializeCbor() writes the
+// data as a byte string, tagged with this number plus the type code (cast to
+// uint8_t), and deserializeCbor() reads it back as an extension.
+// This is not a registered tag: other decoders see a tagged byte string.
+const uint32_t CBOR_EXTENSION_TAG_BASE = 0x4D500000;  // "MP"
+
+}  // namespace ARDUINOJSON_NAMESPACE
@@ -0,0 +1,179 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Cbor/CborMajorType.hpp>
+#include <ArduinoJson/MsgPack/endianess.hpp>
+#include <ArduinoJson/Polyfills/assert.hpp>
+#include <ArduinoJson/Polyfills/type_traits.hpp>
+#include <ArduinoJson/Serialization/CountingDecorator.hpp>
+#include <ArduinoJson/Serialization/measure.hpp>
+#include <ArduinoJson/Serialization/serialize.hpp>
+#include <ArduinoJson/Variant/VariantData.hpp>
+
+namespace ARDUINOJSON_NAMESPACE {
+
+template <typename TWriter>
+class CborSerializer : public Visitor<size_t> {
+ public:
+  static const bool producesText = false;
+
+  CborSerializer(TWriter writer) : _writer(writer) {}
+
+  template <typename T>
+  typename enable_if<sizeof(T) == 4, size_t>::type visitFloat(T value32) {
+    if (canConvertNumber<Integer>(value32)) {
+      Integer truncatedValue = Integer(value32);
+      if (value32 == T(truncatedValue))
+        return visitSignedInteger(truncatedValue);
+    }
+    writeByte(0xFA);
+    writeInteger(value32);
+    return bytesWritten();
+  }
+
+  template <typename T>
+  ARDUINOJSON_NO_SANITIZE("float-cast-overflow")
+  typename enable_if<sizeof(T) == 8, size_t>::type visitFloat(T value64) {
+    float value32 = float(value64);
+    if (value32 == value64)
+      return visitFloat(value32);
+    writeByte(0xFB);
+    writeInteger(value64);
+    return bytesWritten();
+  }
+
+  size_t visitArray(const CollectionData& array) {
+    writeHead(CBOR_ARRAY, array.size());
+    for (const VariantSlot* slot = array.head(); slot; slot = slot->next()) {
+      slot->data()->resolve()->accept(*this);
+    }
+    return bytesWritten();
+  }
+
+  size_t visitObject(const CollectionData& object) {
+    writeHead(CBOR_MAP, object.size());
+    for (const VariantSlot* slot = object.head(); slot; slot = slot->next()) {
+      visitString(slot->key(), slot->keySize());
+      slot->data()->resolve()->accept(*this);
+    }
+    return bytesWritten();
+  }
+
+  size_t visitString(const char* value) {
+    return visitString(value, strlen(value));
+  }
+
+  size_t visitString(const char* value, size_t n) {
+    ARDUINOJSON_ASSERT(value != NULL);
+    writeHead(CBOR_TEXT_STRING, n);
+    writeBytes(reinterpret_cast<const uint8_t*>(value), n);
+    return bytesWritten();
+  }
+
+  size_t visitBinary(const uint8_t* data, size_t n) {
+    writeHead(CBOR_BYTE_STRING, n);
+    writeBytes(data, n);
+    return bytesWritten();
+  }
+
+  // See CBOR_EXTENSION_TAG_BASE
+  size_t visitExtension(int8_t type, const uint8_t* data, size_t n) {
+    writeHead(CBOR_TAG, CBOR_EXTENSION_TAG_BASE + uint8_t(type));
+    return visitBinary(data, n);
+  }
+
+  size_t visitRawJson(const char* data, size_t size) {
+    writeBytes(reinterpret_cast<const uint8_t*>(data), size);
+    return bytesWritten();
+  }
+
+  size_t visitSignedInteger(Integer value) {
+    if (value >= 0)
+      writeHead(CBOR_UNSIGNED_INTEGER, static_cast<UInt>(value));
+    else  // -1-n
+      writeHead(CBOR_NEGATIVE_INTEGER, ~static_cast<UInt>(value));
+    return bytesWritten();
+  }
+
+  size_t visitUnsignedInteger(UInt value) {
+    writeHead(CBOR_UNSIGNED_INTEGER, value);
+    return bytesWritten();
+  }
+
+  size_t visitBoolean(bool value) {
+    writeByte(value ? 0xF5 : 0xF4);
+    return bytesWritten();
+  }
+
+  size_t visitNull() {
+    writeByte(0xF6);
+    return bytesWritten();
+  }
+
+ private:
+  size_t bytesWritten() const {
+    return _writer.count();
+  }
+
+  // Writes the initial byte and the shortest argument that holds the value
+  void writeHead(CborMajorType type, UInt value) {
+    if (value < 24) {
+      writeByte(uint8_t(uint8_t(type) | uint8_t(value)));
+    } else if (value <= 0xFF) {
+      writeByte(uint8_t(uint8_t(type) | 24));
+      writeInteger(uint8_t(value));
+    } else if (value <= 0xFFFF) {
+      writeByte(uint8_t(uint8_t(type) | 25));
+      writeInteger(uint16_t(value));
+    }
+#if ARDUINOJSON_USE_LONG_LONG
+    else if (value <= 0xFFFFFFFF)
+#else
+    else
+#endif
+    {
+      writeByte(uint8_t(uint8_t(type) | 26));
+      writeInteger(uint32_t(value));
+    }
+#if ARDUINOJSON_USE_LONG_LONG
+    else {
+      writeByte(uint8_t(uint8_t(type) | 27));
+      writeInteger(uint64_t(value));
+    }
+#endif
+  }
+
+  void writeByte(uint8_t c) {
+    _writer.write(c);
+  }
+
+  void writeBytes(const uint8_t* p, size_t n) {
+    _writer.write(p, n);
+  }
+
+  template <typename T>
+  void writeInteger(T value) {
+    fixEndianess(value);
+    writeBytes(reinterpret_cast<uint8_t*>(&value), sizeof(value));
+  }
+
+  CountingDecorator<TWriter> _writer;
+};
+
+template <typename TDestination>
+inline size_t serializeCbor(VariantConstRef source, TDestination& output) {
+  return serialize<CborSerializer>(source, output);
+}
+
+inline size_t serializeCbor(VariantConstRef source, void* output, size_t size) {
+  return serialize<CborSerializer>(source, output, size);
+}
+
+inline size_t measureCbor(VariantConstRef source) {
+  return measure<CborSerializer>(source);
+}
+
+}  // namespace ARDUINOJSON_NAMESPACE
@@ -0,0 +1,27 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Numbers/FloatTraits.hpp>
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// Converts an IEEE 754 half-precision float (binary16)
+inline float halfToFloat(uint16_t h) {
+  int exponent = (h >> 10) & 0x1f;
+  float mantissa = float(h & 0x3ff);
+  float value;
+  if (exponent == 0)  // subnormal
+    value = mantissa / 16777216.0f;  // 2^24
+  else if (exponent == 0x1f)
+    value = (h & 0x3ff) ? FloatTraits<float>::nan() : FloatTraits<float>::inf();
+  else if (exponent >= 25)
+    value = (1024 + mantissa) * float(1L << (exponent - 25));
+  else
+    value = (1024 + mantissa) / float(1L << (25 - exponent));
+  return h & 0x8000 ? -value : value;
+}
+
+}  // namespace ARDUINOJSON_NAMESPACE
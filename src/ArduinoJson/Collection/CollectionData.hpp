@@ -4,20 +4,24 @@
 
 #pragma once
 
+#include <ArduinoJson/Memory/RelativePointer.hpp>
 #include <ArduinoJson/Namespace.hpp>
 #include <ArduinoJson/Polyfills/assert.hpp>
 
 #include <stddef.h>  // size_t
+#include <stdint.h>  // uint8_t
 
 namespace ARDUINOJSON_NAMESPACE {
 
 class MemoryPool;
+class String;
 class VariantData;
 class VariantSlot;
 
 class CollectionData {
-  VariantSlot *_head;
-  VariantSlot *_tail;
+  // relative to this, see RelativePointer.hpp
+  ptrdiff_t _head;
+  ptrdiff_t _tail;
 
  public:
   // Must be a POD!
@@ -34,6 +38,9 @@ class CollectionData {
 
   VariantData *getOrAddElement(size_t index, MemoryPool *pool);
 
+  // Adds an element before the one at index, or at the end if index == size()
+  VariantData *insertElement(size_t index, MemoryPool *pool);
+
   void removeElement(size_t index);
 
   // Object only
@@ -41,9 +48,18 @@ class CollectionData {
   template <typename TAdaptedString, typename TStoragePolicy>
   VariantData *addMember(TAdaptedString key, MemoryPool *pool, TStoragePolicy);
 
+  // Adds a member with the key of a member of another collection: a linked
+  // key stays linked, and a key that is already in this pool is shared
+  VariantData *addMember(String key, MemoryPool *pool);
+
   template <typename TAdaptedString>
   VariantData *getMember(TAdaptedString key) const;
 
+  // Same as getMember(), but starts after the cursor, and wraps around.
+  // On success, the cursor moves to the member found.
+  template <typename TAdaptedString>
+  VariantData *getMember(TAdaptedString key, VariantSlot *&cursor) const;
+
   template <typename TAdaptedString, typename TStoragePolicy>
   VariantData *getOrAddMember(TAdaptedString key, MemoryPool *pool,
                               TStoragePolicy);
@@ -53,6 +69,11 @@ class CollectionData {
     removeSlot(getSlot(key));
   }
 
+  // Same as removeMember(), but starts after the cursor, like getMember().
+  // When the member follows the cursor, the removal is O(1).
+  template <typename TAdaptedString>
+  void removeMember(TAdaptedString key, VariantSlot *&cursor);
+
   template <typename TAdaptedString>
   bool containsKey(const TAdaptedString &key) const;
 
@@ -68,7 +89,11 @@ class CollectionData {
   bool copyFrom(const CollectionData &src, MemoryPool *pool);
 
   VariantSlot *head() const {
-    return _head;
+    return resolveRelative<VariantSlot>(this, _head);
+  }
+
+  VariantSlot *tail() const {
+    return resolveRelative<VariantSlot>(this, _tail);
   }
 
   void movePointers(ptrdiff_t stringDistance, ptrdiff_t variantDistance);
@@ -79,6 +104,23 @@ class CollectionData {
   template <typename TAdaptedString>
   VariantSlot *getSlot(TAdaptedString key) const;
 
+  template <typename TAdaptedString>
+  VariantSlot *getSlot(TAdaptedString key, VariantSlot *after) const;
+
+  template <typename TAdaptedString>
+  static VariantSlot *findSlot(TAdaptedString key, size_t size, uint8_t hash,
+                               VariantSlot *begin, const VariantSlot *end);
+
   VariantSlot *getPreviousSlot(VariantSlot *) const;
+
+  void removeSlot(VariantSlot *slot, VariantSlot *prev);
+
+  void setHead(VariantSlot *slot) {
+    _head = makeRelative(this, slot);
+  }
+
+  void setTail(VariantSlot *slot) {
+    _tail = makeRelative(this, slot);
+  }
 };
 }  // namespace ARDUINOJSON_NAMESPACE
@@ -16,13 +16,13 @@ inline VariantSlot* CollectionData::addSlot(MemoryPool* pool) {
   if (!slot)
     return 0;
 
-  if (_tail) {
-    _tail->setNextNotNull(slot);
-    _tail = slot;
+  VariantSlot* last = tail();
+  if (last) {
+    last->setNextNotNull(slot);
   } else {
-    _head = slot;
-    _tail = slot;
+    setHead(slot);
   }
+  setTail(slot);
 
   slot->clear();
   return slot;
@@ -44,6 +44,13 @@ inline VariantData* CollectionData::addMember(TAdaptedString key,
   return slot->data();
 }
 
+inline VariantData* CollectionData::addMember(String key, MemoryPool* pool) {
+  if (key.isLinked() || !pool->owns(key.c_str()))
+    return addMember(adaptString(key), pool, getStringStoragePolicy(key));
+  else
+    return addMember(adaptString(key), pool, SharedStringStoragePolicy());
+}
+
 inline void CollectionData::clear() {
   _head = 0;
   _tail = 0;
@@ -57,11 +64,10 @@ inline bool CollectionData::containsKey(const TAdaptedString& key) const {
 inline bool CollectionData::copyFrom(const CollectionData& src,
                                      MemoryPool* pool) {
   clear();
-  for (VariantSlot* s = src._head; s; s = s->next()) {
+  for (VariantSlot* s = src.head(); s; s = s->next()) {
     VariantData* var;
     if (s->key() != 0) {
-      String key(s->key(), s->ownsKey() ? String::Copied : String::Linked);
-      var = addMember(adaptString(key), pool, getStringStoragePolicy(key));
+      var = addMember(s->keyString(), pool);
     } else {
       var = addElement(pool);
     }
@@ -75,25 +81,56 @@ inline bool CollectionData::copyFrom(const CollectionData& src,
 
 template <typename TAdaptedString>
 inline VariantSlot* CollectionData::getSlot(TAdaptedString key) const {
+  return getSlot(key, 0);
+}
+
+template <typename TAdaptedString>
+inline VariantSlot* CollectionData::getSlot(TAdaptedString key,
+                                            VariantSlot* after) const {
   if (key.isNull())
     return 0;
-  VariantSlot* slot = _head;
-  while (slot) {
-    if (stringEquals(key, adaptString(slot->key())))
-      break;
-    slot = slot->next();
-  }
+  size_t size = key.size();
+#if ARDUINOJSON_SLOT_KEY_HASH
+  uint8_t hash = stringHash(key);
+#else
+  uint8_t hash = 0;
+#endif
+  VariantSlot* start = after ? after->next() : 0;
+  VariantSlot* slot = start ? findSlot(key, size, hash, start, 0) : 0;
+  if (!slot)
+    slot = findSlot(key, size, hash, head(), start);
   return slot;
 }
 
+// Searches the member in [begin, end)
+template <typename TAdaptedString>
+inline VariantSlot* CollectionData::findSlot(TAdaptedString key, size_t size,
+                                             uint8_t hash, VariantSlot* begin,
+                                             const VariantSlot* end) {
+  for (VariantSlot* slot = begin; slot != end; slot = slot->next()) {
+    if (stringPointsTo(key, slot->key()))
+      return slot;
+#if ARDUINOJSON_SLOT_KEY_HASH
+    if (slot->keyHash() != hash)
+      continue;
+#else
+    (void)hash;
+#endif
+    if (slot->keySize() == size && stringEquals(key, slot->key(), size))
+      return slot;
+  }
+  return 0;
+}
+
 inline VariantSlot* CollectionData::getSlot(size_t index) const {
-  if (!_head)
+  VariantSlot* first = head();
+  if (!first)
     return 0;
-  return _head->next(index);
+  return first->next(index);
 }
 
 inline VariantSlot* CollectionData::getPreviousSlot(VariantSlot* target) const {
-  VariantSlot* current = _head;
+  VariantSlot* current = head();
   while (current) {
     VariantSlot* next = current->next();
     if (next == target)
@@ -109,6 +146,16 @@ inline VariantData* CollectionData::getMember(TAdaptedString key) const {
   return slot ? slot->data() : 0;
 }
 
+template <typename TAdaptedString>
+inline VariantData* CollectionData::getMember(TAdaptedString key,
+                                              VariantSlot*& cursor) const {
+  VariantSlot* slot = getSlot(key, cursor);
+  if (!slot)
+    return 0;
+  cursor = slot;
+  return slot->data();
+}
+
 template <typename TAdaptedString, typename TStoragePolicy>
 inline VariantData* CollectionData::getOrAddMember(
     TAdaptedString key, MemoryPool* pool, TStoragePolicy storage_policy) {
@@ -131,7 +178,7 @@ inline VariantData* CollectionData::getElement(size_t index) const {
 
 inline VariantData* CollectionData::getOrAddElement(size_t index,
                                                     MemoryPool* pool) {
-  VariantSlot* slot = _head;
+  VariantSlot* slot = head();
   while (slot && index > 0) {
     slot = slot->next();
     index--;
@@ -145,17 +192,53 @@ inline VariantData* CollectionData::getOrAddElement(size_t index,
   return slotData(slot);
 }
 
+inline VariantData* CollectionData::insertElement(size_t index,
+                                                  MemoryPool* pool) {
+  VariantSlot* next = getSlot(index);
+  VariantSlot* slot = addSlot(pool);
+  if (!slot || !next)
+    return slotData(slot);
+
+  // move the new slot from the end to its position
+  VariantSlot* last = getPreviousSlot(slot);
+  last->setNext(0);
+  setTail(last);
+  VariantSlot* prev = getPreviousSlot(next);
+  slot->setNextNotNull(next);
+  if (prev)
+    prev->setNextNotNull(slot);
+  else
+    setHead(slot);
+  return slot->data();
+}
+
+template <typename TAdaptedString>
+inline void CollectionData::removeMember(TAdaptedString key,
+                                         VariantSlot*& cursor) {
+  VariantSlot* prev = cursor;
+  VariantSlot* slot = getSlot(key, cursor);
+  if (!slot)
+    return;
+  if (slot != (prev ? prev->next() : head()))
+    prev = getPreviousSlot(slot);
+  removeSlot(slot, prev);
+  cursor = prev;
+}
+
 inline void CollectionData::removeSlot(VariantSlot* slot) {
   if (!slot)
     return;
-  VariantSlot* prev = getPreviousSlot(slot);
+  removeSlot(slot, getPreviousSlot(slot));
+}
+
+inline void CollectionData::removeSlot(VariantSlot* slot, VariantSlot* prev) {
   VariantSlot* next = slot->next();
   if (prev)
     prev->setNext(next);
   else
-    _head = next;
+    setHead(next);
   if (!next)
-    _tail = prev;
+    setTail(prev);
 }
 
 inline void CollectionData::removeElement(size_t index) {
@@ -164,33 +247,38 @@ inline void CollectionData::removeElement(size_t index) {
 
 inline size_t CollectionData::memoryUsage() const {
   size_t total = 0;
-  for (VariantSlot* s = _head; s; s = s->next()) {
+  for (VariantSlot* s = head(); s; s = s->next()) {
     total += sizeof(VariantSlot) + s->data()->memoryUsage();
     if (s->ownsKey())
-      total += strlen(s->key()) + 1;
+      total += s->keySize() + 1;
   }
   return total;
 }
 
 inline size_t CollectionData::size() const {
-  return slotSize(_head);
+  return slotSize(head());
 }
 
-template <typename T>
-inline void movePointer(T*& p, ptrdiff_t offset) {
-  if (!p)
-    return;
-  p = reinterpret_cast<T*>(
-      reinterpret_cast<void*>(reinterpret_cast<char*>(p) + offset));
-  ARDUINOJSON_ASSERT(isAligned(p));
+inline void movePointer(ptrdiff_t& p, ptrdiff_t offset) {
+  if (p)
+    p += offset;
 }
 
+// Called when the strings moved by stringDistance and the variants moved by
+// variantDistance, relative to this collection.
 inline void CollectionData::movePointers(ptrdiff_t stringDistance,
                                          ptrdiff_t variantDistance) {
   movePointer(_head, variantDistance);
   movePointer(_tail, variantDistance);
-  for (VariantSlot* slot = _head; slot; slot = slot->next())
-    slot->movePointers(stringDistance, variantDistance);
+  ARDUINOJSON_ASSERT(isAligned(head()));
+  ARDUINOJSON_ASSERT(isAligned(tail()));
+
+  // Children moved along with their variants, so their references are only
+  // invalid if the strings moved differently (for example, after a squash).
+  if (stringDistance == variantDistance)
+    return;
+  for (VariantSlot* slot = head(); slot; slot = slot->next())
+    slot->movePointers(stringDistance - variantDistance, 0);
 }
 
 }  // namespace ARDUINOJSON_NAMESPACE
@@ -20,6 +20,16 @@
 #  endif
 #endif
 
+// C++20: consteval functions and class types as template parameters
+#ifndef ARDUINOJSON_HAS_CONSTEVAL
+#  if defined(__cpp_consteval) && defined(__cpp_nontype_template_args) && \
+      __cpp_nontype_template_args >= 201911L
+#    define ARDUINOJSON_HAS_CONSTEVAL 1
+#  else
+#    define ARDUINOJSON_HAS_CONSTEVAL 0
+#  endif
+#endif
+
 #if defined(_MSC_VER) && !ARDUINOJSON_HAS_LONG_LONG
 #  define ARDUINOJSON_HAS_INT64 1
 #else
@@ -76,6 +86,17 @@
 #  endif
 #endif
 
+// Support memory-mapped files with MappedFile, which requires <sys/mman.h>
+#ifndef ARDUINOJSON_ENABLE_MMAP
+#  define ARDUINOJSON_ENABLE_MMAP 0
+#endif
+
+// Support SharedJsonDocument and JsonDocumentPublisher, which require C++11,
+// <atomic>, and <mutex>
+#ifndef ARDUINOJSON_ENABLE_SHARED_DOCUMENT
+#  define ARDUINOJSON_ENABLE_SHARED_DOCUMENT 0
+#endif
+
 // Store floating-point values with float (0) or double (1)
 #ifndef ARDUINOJSON_USE_DOUBLE
 #  define ARDUINOJSON_USE_DOUBLE 1
@@ -114,6 +135,30 @@
 #  endif
 #endif
 
+// Store a hash of the key in each slot, so that lookups skip most of the
+// members without comparing the strings.
+// The hash goes in the padding before the pointer to the next node, so it's
+// free unless ARDUINOJSON_SLOT_OFFSET_SIZE is 1.
+#ifndef ARDUINOJSON_SLOT_KEY_HASH
+#  if ARDUINOJSON_SLOT_OFFSET_SIZE > 1
+#    define ARDUINOJSON_SLOT_KEY_HASH 1
+#  else
+#    define ARDUINOJSON_SLOT_KEY_HASH 0
+#  endif
+#endif
+
+// Store the length of the key in each slot, so that lookups and serializers
+// don't call strlen().
+// The length takes two bytes of the padding before the pointer to the next
+// node, so it's free when ARDUINOJSON_SLOT_OFFSET_SIZE is 4.
+#ifndef ARDUINOJSON_SLOT_KEY_SIZE
+#  if ARDUINOJSON_SLOT_OFFSET_SIZE >= 4
+#    define ARDUINOJSON_SLOT_KEY_SIZE 1
+#  else
+#    define ARDUINOJSON_SLOT_KEY_SIZE 0
+#  endif
+#endif
+
 #ifdef ARDUINO
 
 // Enable support for Arduino's String class
@@ -222,6 +267,29 @@
 #  define ARDUINOJSON_STRING_BUFFER_SIZE 32
 #endif
 
+// Encoding of MessagePack binaries and extensions in JSON:
+// 1 = base64 string, 0 = hexadecimal string
+#ifndef ARDUINOJSON_ENCODE_BINARY_AS_BASE64
+#  define ARDUINOJSON_ENCODE_BINARY_AS_BASE64 1
+#endif
+
+// Size of the buffer that batches the writes to streams (std::ostream, Print,
+// custom writers); 0 sends each byte directly.
+// The buffer is on the stack, so it's smaller on microcontrollers.
+#ifndef ARDUINOJSON_STREAM_BUFFER_SIZE
+#  if defined(__SIZEOF_POINTER__) && __SIZEOF_POINTER__ <= 2
+// Address space == 16-bit (AVR...)
+#    define ARDUINOJSON_STREAM_BUFFER_SIZE 32
+#  elif defined(__SIZEOF_POINTER__) && __SIZEOF_POINTER__ >= 8 || \
+      defined(_WIN64) && _WIN64
+// Address space == 64-bit
+#    define ARDUINOJSON_STREAM_BUFFER_SIZE 256
+#  else
+// Address space == 32-bit (ESP8266, ESP32...)
+#    define ARDUINOJSON_STREAM_BUFFER_SIZE 64
+#  endif
+#endif
+
 #ifndef ARDUINOJSON_DEBUG
 #  ifdef __PLATFORMIO_BUILD_DEBUG__
 #    define ARDUINOJSON_DEBUG 1
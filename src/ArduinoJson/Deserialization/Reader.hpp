@@ -10,6 +10,25 @@
 
 namespace ARDUINOJSON_NAMESPACE {
 
+// Discards n bytes by reading them in small chunks.
+// Used by the readers that cannot jump forward.
+// Returns the number of bytes actually skipped.
+template <typename TReader>
+size_t skipByReading(TReader& reader, size_t n) {
+  char buffer[32];
+  size_t skipped = 0;
+  while (skipped < n) {
+    size_t chunk = n - skipped;
+    if (chunk > sizeof(buffer))
+      chunk = sizeof(buffer);
+    size_t count = reader.readBytes(buffer, chunk);
+    skipped += count;
+    if (count < chunk)
+      break;
+  }
+  return skipped;
+}
+
 // The default reader is a simple wrapper for Readers that are not copiable
 template <typename TSource, typename Enable = void>
 struct Reader {
@@ -24,6 +43,10 @@ struct Reader {
     return _source->readBytes(buffer, length);
   }
 
+  size_t skip(size_t n) {
+    return skipByReading(*this, n);
+  }
+
  private:
   TSource* _source;
 };
@@ -54,3 +77,7 @@ struct BoundedReader {
 #if ARDUINOJSON_ENABLE_STD_STREAM
 #  include <ArduinoJson/Deserialization/Readers/StdStreamReader.hpp>
 #endif
+
+#if ARDUINOJSON_ENABLE_MMAP
+#  include <ArduinoJson/Deserialization/Readers/MappedFileReader.hpp>
+#endif
@@ -24,6 +24,10 @@ struct Reader<TSource,
     return _stream->readBytes(buffer, length);
   }
 
+  size_t skip(size_t n) {
+    return skipByReading(*this, n);
+  }
+
  private:
   Stream* _stream;
 };
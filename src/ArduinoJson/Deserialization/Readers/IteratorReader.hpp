@@ -26,6 +26,15 @@ class IteratorReader {
     while (i < length && _ptr < _end) buffer[i++] = *_ptr++;
     return i;
   }
+
+  size_t skip(size_t n) {
+    size_t i = 0;
+    while (i < n && _ptr < _end) {
+      ++_ptr;
+      ++i;
+    }
+    return i;
+  }
 };
 
 template <typename T>
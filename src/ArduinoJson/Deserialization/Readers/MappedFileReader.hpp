@@ -0,0 +1,78 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Misc/SafeBoolIdiom.hpp>
+
+#include <fcntl.h>     // open
+#include <sys/mman.h>  // mmap, munmap, madvise
+#include <sys/stat.h>  // fstat
+#include <unistd.h>    // close
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// Maps a file in memory, so it can be deserialized without being copied.
+// A file that cannot be mapped behaves like an empty input.
+class MappedFile : public SafeBoolIdom<MappedFile> {
+ public:
+  explicit MappedFile(const char* path) : _data(0), _size(0) {
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0)
+      return;
+    map(fd);
+    ::close(fd);  // the mapping remains valid
+  }
+
+  // The file descriptor is not closed by the destructor
+  explicit MappedFile(int fd) : _data(0), _size(0) {
+    map(fd);
+  }
+
+  ~MappedFile() {
+    if (_data)
+      ::munmap(_data, _size);
+  }
+
+  const char* data() const {
+    return reinterpret_cast<const char*>(_data);
+  }
+
+  size_t size() const {
+    return _size;
+  }
+
+  // safe bool idiom
+  operator bool_type() const {
+    return _data ? safe_true() : safe_false();
+  }
+
+ private:
+  MappedFile(const MappedFile&);
+  MappedFile& operator=(const MappedFile&);
+
+  void map(int fd) {
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || st.st_size <= 0)
+      return;
+    size_t size = static_cast<size_t>(st.st_size);
+    void* data = ::mmap(0, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED)
+      return;
+    ::madvise(data, size, MADV_SEQUENTIAL);
+    _data = data;
+    _size = size;
+  }
+
+  void* _data;
+  size_t _size;
+};
+
+template <>
+struct Reader<MappedFile, void> : BoundedReader<const char*> {
+  explicit Reader(const MappedFile& file)
+      : BoundedReader<const char*>(file.data(), file.size()) {}
+};
+
+}  // namespace ARDUINOJSON_NAMESPACE
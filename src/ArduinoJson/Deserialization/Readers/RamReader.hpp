@@ -6,6 +6,8 @@
 
 #include <ArduinoJson/Polyfills/type_traits.hpp>
 
+#include <string.h>  // memmove
+
 namespace ARDUINOJSON_NAMESPACE {
 
 template <typename T>
@@ -31,20 +33,55 @@ struct Reader<TSource*,
     return static_cast<unsigned char>(*_ptr++);
   }
 
+  // The buffer may overlap the input when deserializing in place
   size_t readBytes(char* buffer, size_t length) {
-    for (size_t i = 0; i < length; i++) buffer[i] = *_ptr++;
+    memmove(buffer, _ptr, length);
+    _ptr += length;
     return length;
   }
+
+  size_t skip(size_t n) {
+    _ptr += n;
+    return n;
+  }
 };
 
 template <typename TSource>
 struct BoundedReader<TSource*,
-                     typename enable_if<IsCharOrVoid<TSource>::value>::type>
-    : public IteratorReader<const char*> {
+                     typename enable_if<IsCharOrVoid<TSource>::value>::type> {
+  const char* _ptr;
+  const char* _end;
+
  public:
   explicit BoundedReader(const void* ptr, size_t len)
-      : IteratorReader<const char*>(reinterpret_cast<const char*>(ptr),
-                                    reinterpret_cast<const char*>(ptr) + len) {}
+      : _ptr(reinterpret_cast<const char*>(ptr)), _end(_ptr + len) {}
+
+  int read() {
+    if (_ptr < _end)
+      return static_cast<unsigned char>(*_ptr++);
+    else
+      return -1;
+  }
+
+  // The buffer may overlap the input when deserializing in place
+  size_t readBytes(char* buffer, size_t length) {
+    length = clamp(length);
+    memmove(buffer, _ptr, length);
+    _ptr += length;
+    return length;
+  }
+
+  size_t skip(size_t n) {
+    n = clamp(n);
+    _ptr += n;
+    return n;
+  }
+
+ private:
+  size_t clamp(size_t n) const {
+    size_t available = static_cast<size_t>(_end - _ptr);
+    return n < available ? n : available;
+  }
 };
 
 }  // namespace ARDUINOJSON_NAMESPACE
@@ -8,22 +8,52 @@
 
 namespace ARDUINOJSON_NAMESPACE {
 
+// Reads from the streambuf directly, to avoid constructing a sentry for each
+// character. The state of the stream is updated as std::istream would.
 template <typename TSource>
 struct Reader<TSource, typename enable_if<
                            is_base_of<std::istream, TSource>::value>::type> {
  public:
-  explicit Reader(std::istream& stream) : _stream(&stream) {}
+  explicit Reader(std::istream& stream) : _stream(&stream), _buf(0) {
+    // checks the state and flushes the tied stream, only once
+    std::istream::sentry ok(stream, true);
+    if (ok)
+      _buf = stream.rdbuf();
+  }
 
   int read() {
-    return _stream->get();
+    if (!_buf)
+      return -1;
+    std::streambuf::int_type c = _buf->sbumpc();
+    if (std::streambuf::traits_type::eq_int_type(
+            c, std::streambuf::traits_type::eof())) {
+      setEof();
+      return -1;
+    }
+    return c;  // already in the range 0-255
   }
 
   size_t readBytes(char* buffer, size_t length) {
-    _stream->read(buffer, static_cast<std::streamsize>(length));
-    return static_cast<size_t>(_stream->gcount());
+    if (!_buf)
+      return 0;
+    std::streamsize n =
+        _buf->sgetn(buffer, static_cast<std::streamsize>(length));
+    if (n < static_cast<std::streamsize>(length))
+      setEof();
+    return static_cast<size_t>(n);
+  }
+
+  size_t skip(size_t n) {
+    return skipByReading(*this, n);
   }
 
  private:
+  void setEof() {
+    _buf = 0;  // don't read after the end, like std::istream
+    _stream->setstate(std::ios::eofbit | std::ios::failbit);
+  }
+
   std::istream* _stream;
+  std::streambuf* _buf;
 };
 }  // namespace ARDUINOJSON_NAMESPACE
@@ -51,7 +51,8 @@ class BasicJsonDocument : AllocatorOwner<TAllocator>, public JsonDocument {
 
   // Move-constructor
 #if ARDUINOJSON_HAS_RVALUE_REFERENCES
-  BasicJsonDocument(BasicJsonDocument&& src) : AllocatorOwner<TAllocator>(src) {
+  BasicJsonDocument(BasicJsonDocument&& src)
+      : AllocatorOwner<TAllocator>(src) {
     moveAssignFrom(src);
   }
 #endif
@@ -81,10 +82,12 @@ class BasicJsonDocument : AllocatorOwner<TAllocator>, public JsonDocument {
 
   ~BasicJsonDocument() {
     freePool();
+    releaseGrafts();
   }
 
   BasicJsonDocument& operator=(const BasicJsonDocument& src) {
-    copyAssignFrom(src);
+    if (&src != this)
+      copyAssignFrom(src);
     return *this;
   }
 
@@ -119,12 +122,56 @@ class BasicJsonDocument : AllocatorOwner<TAllocator>, public JsonDocument {
     _data.movePointers(ptr_offset, ptr_offset - bytes_reclaimed);
   }
 
+  // Attaches the content of source to target in O(1), without copying it:
+  // this document takes the pool of source, and frees it with its own pool, or
+  // when it's cleared, for example, by deserializeJson() or to<T>().
+  // Like a linked value (see link()), the grafted value is read-only, and
+  // set() copies the reference, not the value. However, a copy of this
+  // document, and garbageCollect(), copy the grafted values.
+  // source is left empty, with a new pool of the same capacity.
+  // Returns false if target doesn't belong to this document, or if the
+  // allocation fails.
+  bool graft(VariantRef target, BasicJsonDocument& source) {
+    VariantData* data = getData(target);
+    if (&source == this || !data || (data != &_data && !_pool.owns(data)))
+      return false;
+    GraftedPool* node =
+        reinterpret_cast<GraftedPool*>(this->allocate(sizeof(GraftedPool)));
+    if (!node)
+      return false;
+
+    node->buffer = source._pool.buffer();
+    node->size = source._pool.size();
+    node->root = source._data;
+    ptrdiff_t distance = reinterpret_cast<char*>(&source._data) -
+                         reinterpret_cast<char*>(&node->root);
+    node->root.movePointers(distance, distance);
+    node->release = &BasicJsonDocument::freeGrafts;
+
+    // the pools grafted to source come along
+    node->next = source._grafts;
+    GraftedPool** tail = &node->next;
+    while (*tail) tail = &(*tail)->next;
+    *tail = _grafts;
+    _grafts = node;
+
+    source._grafts = 0;
+    source._data.setNull();
+    source.replacePool(source.allocPool(source.capacity()));
+
+    data->setPointer(&node->root);
+    return true;
+  }
+
   bool garbageCollect() {
     // make a temporary clone and move assign
     BasicJsonDocument tmp(*this);
     if (!tmp.capacity())
       return false;
     tmp.set(*this);
+    if (_grafts)
+      tmp.copyGrafts(&tmp._data, _grafts);
+    tmp.setKeyDictionary(_pool.keyDictionary());
     moveAssignFrom(tmp);
     return true;
   }
@@ -149,17 +196,64 @@ class BasicJsonDocument : AllocatorOwner<TAllocator>, public JsonDocument {
     this->deallocate(memoryPool().buffer());
   }
 
+  // The release function of the grafted pools, see JsonDocument::clear()
+  static void freeGrafts(JsonDocument* doc) {
+    BasicJsonDocument* self = static_cast<BasicJsonDocument*>(doc);
+    while (self->_grafts) {
+      GraftedPool* next = self->_grafts->next;
+      self->deallocate(self->_grafts->buffer);
+      self->deallocate(self->_grafts);
+      self->_grafts = next;
+    }
+  }
+
   void copyAssignFrom(const JsonDocument& src) {
+    releaseGrafts();
     reallocPool(src.capacity());
     set(src);
   }
 
+  // The copy doesn't refer to the pools grafted to src: it copies them
+  void copyAssignFrom(const BasicJsonDocument& src) {
+    size_t capa = src.capacity();
+    for (const GraftedPool* g = src._grafts; g; g = g->next)
+      capa += g->size;
+    releaseGrafts();
+    reallocPool(capa);
+    set(src);
+    if (src._grafts)
+      copyGrafts(&_data, src._grafts);
+  }
+
+  void copyGrafts(VariantData* var, const GraftedPool* grafts) {
+    if (var->isPointer()) {
+      const VariantData* target = var->resolve();
+      for (const GraftedPool* g = grafts; g; g = g->next) {
+        if (target == &g->root) {
+          var->copyFrom(*target, &_pool);
+          break;
+        }
+      }
+    }
+    CollectionData* col = var->isArray() ? var->asArray() : var->asObject();
+    if (!col)
+      return;
+    for (VariantSlot* s = col->head(); s; s = s->next())
+      copyGrafts(s->data(), grafts);
+  }
+
   void moveAssignFrom(BasicJsonDocument& src) {
     freePool();
+    releaseGrafts();
     _data = src._data;
+    ptrdiff_t distance =
+        reinterpret_cast<char*>(&src._data) - reinterpret_cast<char*>(&_data);
+    _data.movePointers(distance, distance);
     _pool = src._pool;
+    _grafts = src._grafts;
     src._data.setNull();
     src._pool = MemoryPool(0, 0);
+    src._grafts = 0;
   }
 };
 
@@ -14,6 +14,19 @@
 
 namespace ARDUINOJSON_NAMESPACE {
 
+class JsonDocument;
+
+// The pool of another document, taken by BasicJsonDocument::graft(), and freed
+// with the document, or by clear()
+struct GraftedPool {
+  GraftedPool* next;
+  void* buffer;
+  size_t size;
+  VariantData root;  // the root of the other document
+  // Frees all the grafted pools with the allocator of the document
+  void (*release)(JsonDocument*);
+};
+
 class JsonDocument : public Visitable,
                      public VariantOperators<const JsonDocument&> {
  public:
@@ -33,6 +46,7 @@ class JsonDocument : public Visitable,
   }
 
   void clear() {
+    releaseGrafts();
     _pool.clear();
     _data.init();
   }
@@ -59,10 +73,20 @@ class JsonDocument : public Visitable,
     return _pool.overflowed();
   }
 
+  // The deserializers don't copy the keys that are in the dictionary; pass
+  // null to remove the dictionary. See JsonKeyDictionary.
+  void setKeyDictionary(const JsonKeyDictionary* dictionary) {
+    _pool.setKeyDictionary(dictionary);
+  }
+
   size_t nesting() const {
     return variantNesting(&_data);
   }
 
+  uint32_t hash() const {
+    return variantHash(&_data);
+  }
+
   size_t capacity() const {
     return _pool.capacity();
   }
@@ -92,11 +116,21 @@ class JsonDocument : public Visitable,
     return _pool;
   }
 
+  // for internal use only
+  const MemoryPool& memoryPool() const {
+    return _pool;
+  }
+
   // for internal use only
   VariantData& data() {
     return _data;
   }
 
+  // for internal use only
+  const VariantData& data() const {
+    return _data;
+  }
+
   ArrayRef createNestedArray() {
     return addElement().to<ArrayRef>();
   }
@@ -305,21 +339,29 @@ class JsonDocument : public Visitable,
   }
 
  protected:
-  JsonDocument() : _pool(0, 0) {
+  JsonDocument() : _pool(0, 0), _grafts(0) {
     _data.init();
   }
 
-  JsonDocument(MemoryPool pool) : _pool(pool) {
+  JsonDocument(MemoryPool pool) : _pool(pool), _grafts(0) {
     _data.init();
   }
 
-  JsonDocument(char* buf, size_t capa) : _pool(buf, capa) {
+  JsonDocument(char* buf, size_t capa) : _pool(buf, capa), _grafts(0) {
     _data.init();
   }
 
   ~JsonDocument() {}
 
+  // Only a BasicJsonDocument has grafted pools, but every reset of the
+  // document goes through clear(), so the pools are freed here
+  void releaseGrafts() {
+    if (_grafts)
+      _grafts->release(this);
+  }
+
   void replacePool(MemoryPool pool) {
+    pool.setKeyDictionary(_pool.keyDictionary());
     _pool = pool;
   }
 
@@ -333,6 +375,7 @@ class JsonDocument : public Visitable,
 
   MemoryPool _pool;
   VariantData _data;
+  GraftedPool* _grafts;
 
  private:
   JsonDocument(const JsonDocument&);
@@ -0,0 +1,297 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Document/DynamicJsonDocument.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <utility>
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// Makes target an object whose members link to the members of source (see
+// link()): the keys and the values are not copied. This is how an update of a
+// SharedJsonDocument shares the values it doesn't change: link the members of
+// the current version, overwrite or remove the ones that change, and freeze
+// the result with the current version as base.
+// Returns false if the document is full.
+inline bool linkMembers(VariantRef target, VariantConstRef source) {
+  VariantData* data = getData(target);
+  const VariantData* sourceData = getData(source);
+  if (!data)
+    return false;
+  CollectionData& object = data->toObject();
+  if (!sourceData || !sourceData->resolve()->isObject())
+    return true;
+  MemoryPool* pool = getPool(target);
+  for (const VariantSlot* s = sourceData->resolve()->asObject()->head(); s;
+       s = s->next()) {
+    VariantData* member = object.addMember(
+        adaptString(s->key(), s->keySize()), pool, LinkStringStoragePolicy());
+    if (!member)
+      return false;
+    member->setPointer(s->data()->resolve());
+  }
+  return true;
+}
+
+// A frozen document, shared by reference counting, like std::shared_ptr: the
+// copies refer to the same document, which is freed with the last copy.
+// The document is immutable, so any number of threads can read it without
+// locking.
+template <typename TAllocator>
+class BasicSharedJsonDocument {
+  struct Node;
+
+ public:
+  BasicSharedJsonDocument() : _node(0) {}
+
+  // Freezes the document, taking its content in O(1); doc is left empty
+  explicit BasicSharedJsonDocument(BasicJsonDocument<TAllocator>& doc)
+      : _node(create(doc, 0)) {}
+
+  // Freezes a document whose values may link to the values of base, see
+  // linkMembers(). The new document keeps alive the versions it links to, and
+  // only them: a version is freed once no other version links to it.
+  BasicSharedJsonDocument(BasicJsonDocument<TAllocator>& doc,
+                          const BasicSharedJsonDocument& base)
+      : _node(create(doc, base._node)) {}
+
+  BasicSharedJsonDocument(const BasicSharedJsonDocument& src)
+      : _node(retain(src._node)) {}
+
+  BasicSharedJsonDocument(BasicSharedJsonDocument&& src) : _node(src._node) {
+    src._node = 0;
+  }
+
+  ~BasicSharedJsonDocument() {
+    release(_node);
+  }
+
+  BasicSharedJsonDocument& operator=(BasicSharedJsonDocument src) {
+    std::swap(_node, src._node);
+    return *this;
+  }
+
+  // Returns false if the allocation failed, or if the handle is empty
+  explicit operator bool() const {
+    return _node != 0;
+  }
+
+  const JsonDocument& operator*() const {
+    ARDUINOJSON_ASSERT(_node != 0);
+    return _node->doc;
+  }
+
+  const JsonDocument* operator->() const {
+    ARDUINOJSON_ASSERT(_node != 0);
+    return &_node->doc;
+  }
+
+  operator VariantConstRef() const {
+    return _node ? VariantConstRef(&_node->doc.data()) : VariantConstRef();
+  }
+
+  friend bool operator==(const BasicSharedJsonDocument& lhs,
+                         const BasicSharedJsonDocument& rhs) {
+    return lhs._node == rhs._node;
+  }
+
+  friend bool operator!=(const BasicSharedJsonDocument& lhs,
+                         const BasicSharedJsonDocument& rhs) {
+    return lhs._node != rhs._node;
+  }
+
+ private:
+  template <typename>
+  friend class BasicJsonDocumentPublisher;
+
+  struct Node {
+    Node(BasicJsonDocument<TAllocator>& src)
+        : refs(1), doc(std::move(src)), bases(0), baseCount(0) {}
+
+    bool contains(const void* p) const {
+      return p == &doc.data() || doc.memoryPool().owns(p);
+    }
+
+    std::atomic<long> refs;
+    BasicJsonDocument<TAllocator> doc;
+    Node** bases;  // the versions this one links to
+    size_t baseCount;
+  };
+
+  explicit BasicSharedJsonDocument(Node* node) : _node(node) {}
+
+  static Node* create(BasicJsonDocument<TAllocator>& doc, Node* base) {
+    TAllocator allocator = doc.allocator();
+    void* p = allocator.allocate(sizeof(Node));
+    if (!p)
+      return 0;
+    Node* node = new (p) Node(doc);
+    if (base && !linkBases(node, base)) {
+      release(node);
+      return 0;
+    }
+    return node;
+  }
+
+  // Keeps alive base, and the versions base links to, if the document links
+  // to them, either with a linked value or with a linked key. A linked value
+  // that belongs to none of them (for example, a grafted value) keeps them all
+  // alive.
+  static bool linkBases(Node* node, Node* base) {
+    size_t count = base->baseCount + 1;
+    Node** candidates = static_cast<Node**>(
+        node->doc.allocator().allocate(count * sizeof(Node*)));
+    if (!candidates)
+      return false;
+    candidates[0] = base;
+    for (size_t i = 1; i < count; i++) candidates[i] = base->bases[i - 1];
+
+    // the used candidates are moved to the front
+    size_t used = 0;
+    findBases(&node->doc.data(), candidates, count, used);
+    if (!used) {
+      node->doc.allocator().deallocate(candidates);
+      return true;
+    }
+    for (size_t i = 0; i < used; i++) candidates[i]->refs.fetch_add(1);
+    node->bases = candidates;
+    node->baseCount = used;
+    return true;
+  }
+
+  static void findBases(const VariantData* var, Node** candidates,
+                        size_t count, size_t& used) {
+    if (var->isPointer()) {
+      if (!useBase(var->resolve(), candidates, count, used))
+        used = count;  // unknown link: keep them all
+      return;
+    }
+    const CollectionData* col =
+        var->isArray() ? var->asArray() : var->asObject();
+    if (!col)
+      return;
+    for (const VariantSlot* s = col->head(); s && used < count; s = s->next()) {
+      if (s->key())
+        useBase(s->key(), candidates, count, used);
+      findBases(s->data(), candidates, count, used);
+    }
+  }
+
+  // Moves the candidate that contains p to the front
+  static bool useBase(const void* p, Node** candidates, size_t count,
+                      size_t& used) {
+    size_t i = 0;
+    while (i < count && !candidates[i]->contains(p)) i++;
+    if (i == count)
+      return false;
+    if (i >= used)
+      std::swap(candidates[used++], candidates[i]);
+    return true;
+  }
+
+  static Node* retain(Node* node) {
+    if (node)
+      node->refs.fetch_add(1, std::memory_order_relaxed);
+    return node;
+  }
+
+  static void release(Node* node) {
+    if (!node || node->refs.fetch_sub(1, std::memory_order_acq_rel) != 1)
+      return;
+    Node** bases = node->bases;
+    size_t baseCount = node->baseCount;
+    TAllocator allocator = node->doc.allocator();
+    node->~Node();
+    allocator.deallocate(node);
+    for (size_t i = 0; i < baseCount; i++) release(bases[i]);
+    if (bases)
+      allocator.deallocate(bases);
+  }
+
+  Node* _node;
+};
+
+// Publishes the current version of a SharedJsonDocument: readers call load()
+// to get a snapshot, and a writer replaces it with publish().
+// load() never waits: it increments two counters and doesn't lock anything.
+// Calling load() once per request, and then reading the snapshot, scales with
+// the number of threads, because reading a snapshot writes nothing.
+// publish() waits for the load() calls in progress, which take a few
+// nanoseconds, before releasing the previous version; concurrent calls to
+// publish() are serialized by a mutex.
+template <typename TAllocator>
+class BasicJsonDocumentPublisher {
+  typedef typename BasicSharedJsonDocument<TAllocator>::Node Node;
+
+ public:
+  typedef BasicSharedJsonDocument<TAllocator> Document;
+
+  BasicJsonDocumentPublisher() : _current(0), _epoch(0) {
+    _readers[0] = 0;
+    _readers[1] = 0;
+  }
+
+  explicit BasicJsonDocumentPublisher(const Document& doc)
+      : _current(Document::retain(doc._node)), _epoch(0) {
+    _readers[0] = 0;
+    _readers[1] = 0;
+  }
+
+  ~BasicJsonDocumentPublisher() {
+    Document::release(_current.load());
+  }
+
+  Document load() const {
+    // The writer waits until the counter of the current epoch drops to zero,
+    // so the version can't be released between the two lines below.
+    std::atomic<long>& readers = _readers[_epoch.load() & 1];
+    readers.fetch_add(1);
+    Node* node = Document::retain(_current.load());
+    readers.fetch_sub(1);
+    return Document(node);
+  }
+
+  void publish(const Document& doc) {
+    exchange(doc);
+  }
+
+  // Publishes doc, and returns the previous version
+  Document exchange(const Document& doc) {
+    std::lock_guard<std::mutex> lock(_writer);
+    Node* previous = _current.exchange(Document::retain(doc._node));
+    waitForReaders();
+    return Document(previous);
+  }
+
+ private:
+  BasicJsonDocumentPublisher(const BasicJsonDocumentPublisher&);
+  BasicJsonDocumentPublisher& operator=(const BasicJsonDocumentPublisher&);
+
+  // The readers that started before the swap may hold the previous version,
+  // so we wait for both counters, like the "Left-Right" algorithm: the new
+  // readers use the other counter, so the writer never starves.
+  void waitForReaders() {
+    unsigned previous = _epoch.load() & 1;
+    unsigned next = previous ^ 1;
+    while (_readers[next].load() != 0) std::this_thread::yield();
+    _epoch.store(next);
+    while (_readers[previous].load() != 0) std::this_thread::yield();
+  }
+
+  std::atomic<Node*> _current;
+  std::atomic<unsigned> _epoch;
+  mutable std::atomic<long> _readers[2];
+  std::mutex _writer;
+};
+
+typedef BasicSharedJsonDocument<DefaultAllocator> SharedJsonDocument;
+typedef BasicJsonDocumentPublisher<DefaultAllocator> JsonDocumentPublisher;
+
+}  // namespace ARDUINOJSON_NAMESPACE
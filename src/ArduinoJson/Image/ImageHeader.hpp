@@ -0,0 +1,89 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Deserialization/DeserializationError.hpp>
+#include <ArduinoJson/Memory/Alignment.hpp>
+#include <ArduinoJson/Polyfills/integer.hpp>
+#include <ArduinoJson/Variant/VariantData.hpp>
+#include <ArduinoJson/Variant/VariantSlot.hpp>
+
+#include <string.h>  // memcmp, memcpy
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// Bump this number when the layout of VariantSlot or the meaning of its flags
+// changes
+#define ARDUINOJSON_IMAGE_VERSION 3
+
+// An image is a verbatim copy of the memory pool:
+//
+// +----------+-------------+-----------+-------------+
+// |  header  |  strings... | (padding) | variants... |
+// +----------+-------------+-----------+-------------+
+//
+// All the references are relative (see RelativePointer.hpp), so an image can
+// be used wherever it is loaded, as long as it's properly aligned.
+struct ImageHeader {
+  char magic[4];
+  uint8_t abi[8];
+  size_t stringsSize;
+  size_t variantsSize;
+  VariantData root;
+
+  void init(size_t stringZoneSize, size_t variantZoneSize) {
+    memcpy(magic, "AJIM", sizeof(magic));
+    getAbi(abi);
+    stringsSize = stringZoneSize;
+    variantsSize = variantZoneSize;
+  }
+
+  DeserializationError validate(size_t imageSize) const {
+    if (memcmp(magic, "AJIM", sizeof(magic)) != 0)
+      return DeserializationError::InvalidInput;
+    uint8_t expectedAbi[sizeof(abi)];
+    getAbi(expectedAbi);
+    if (memcmp(abi, expectedAbi, sizeof(abi)) != 0)
+      return DeserializationError::InvalidInput;
+    if (variantsSize % sizeof(VariantSlot) != 0)
+      return DeserializationError::InvalidInput;
+    if (stringsSize > imageSize || variantsSize > imageSize ||
+        size() > imageSize)
+      return DeserializationError::IncompleteInput;
+    return DeserializationError::Ok;
+  }
+
+  const char* strings() const {
+    return reinterpret_cast<const char*>(this) + sizeof(ImageHeader);
+  }
+
+  const char* variants() const {
+    return reinterpret_cast<const char*>(this) + variantsOffset();
+  }
+
+  size_t variantsOffset() const {
+    return addPadding(sizeof(ImageHeader) + stringsSize);
+  }
+
+  size_t size() const {
+    return variantsOffset() + variantsSize;
+  }
+
+  // Describes everything that affects the memory layout, so that an image is
+  // rejected by a program that was built with a different configuration
+  static void getAbi(uint8_t* tag) {
+    tag[0] = ARDUINOJSON_IMAGE_VERSION;
+    tag[1] = sizeof(void*);
+    tag[2] = sizeof(VariantSlot);
+    tag[3] = sizeof(Float);
+    tag[4] = sizeof(Integer);
+    tag[5] = ARDUINOJSON_SLOT_OFFSET_SIZE | (ARDUINOJSON_SLOT_KEY_HASH << 4) |
+             (ARDUINOJSON_SLOT_KEY_SIZE << 5);
+    tag[6] = ARDUINOJSON_LITTLE_ENDIAN;
+    tag[7] = ARDUINOJSON_ENABLE_ALIGNMENT;
+  }
+};
+
+}  // namespace ARDUINOJSON_NAMESPACE
@@ -0,0 +1,197 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Deserialization/NestingLimit.hpp>
+#include <ArduinoJson/Document/JsonDocument.hpp>
+#include <ArduinoJson/Image/ImageHeader.hpp>
+#include <ArduinoJson/Variant/Visitor.hpp>
+
+#include <string.h>  // memchr, memcpy
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// Checks that the references of an image stay inside the image: each owned
+// string must end in the string zone, each slot must be in the variant zone,
+// and each collection must be a list that ends with its tail.
+// The image is read-only, so the slots are counted instead of being marked:
+// the tree can't have more slots than the variant zone, which stops the loops.
+class ImageValidator : public Visitor<DeserializationError> {
+ public:
+  ImageValidator(const ImageHeader* header)
+      : _strings(header->strings()),
+        _stringsEnd(_strings + header->stringsSize),
+        _variants(header->variants()),
+        _variantsEnd(_variants + header->variantsSize),
+        _remainingSlots(header->variantsSize / sizeof(VariantSlot)) {}
+
+  DeserializationError validate(const VariantData* var,
+                                NestingLimit nestingLimit) {
+    switch (var->type()) {
+      case VALUE_IS_BOOLEAN:
+        // a bool must be 0 or 1, and the content is the first member
+        return *reinterpret_cast<const uint8_t*>(var) <= 1
+                   ? DeserializationError::Ok
+                   : DeserializationError::InvalidInput;
+
+      case VALUE_IS_NULL:
+      case VALUE_IS_UNSIGNED_INTEGER:
+      case VALUE_IS_SIGNED_INTEGER:
+      case VALUE_IS_FLOAT:
+        return DeserializationError::Ok;
+
+      case VALUE_IS_OWNED_RAW:
+      case VALUE_IS_OWNED_STRING:
+      case VALUE_IS_OWNED_BINARY:
+      case VALUE_IS_OWNED_EXTENSION:
+        return var->accept(*this);
+
+      case VALUE_IS_ARRAY:
+      case VALUE_IS_OBJECT:
+        if (nestingLimit.reached())
+          return DeserializationError::TooDeep;
+        return validateCollection(*var->asCollection(), var->isObject(),
+                                  nestingLimit.decrement());
+
+      default:  // links can't be saved in an image, see serializeImage()
+        return DeserializationError::InvalidInput;
+    }
+  }
+
+  DeserializationError visitString(const char* s, size_t n) {
+    return containsString(s, n) && s[n] == 0
+               ? DeserializationError::Ok
+               : DeserializationError::InvalidInput;
+  }
+
+  DeserializationError visitRawJson(const char* s, size_t n) {
+    return containsString(s, n) ? DeserializationError::Ok
+                                : DeserializationError::InvalidInput;
+  }
+
+  DeserializationError visitBinary(const uint8_t* data, size_t n) {
+    return visitRawJson(reinterpret_cast<const char*>(data), n);
+  }
+
+  DeserializationError visitExtension(int8_t, const uint8_t* data, size_t n) {
+    // the type code precedes the data
+    return visitRawJson(reinterpret_cast<const char*>(data) - 1, n + 1);
+  }
+
+ private:
+  DeserializationError validateCollection(const CollectionData& col,
+                                          bool isObject,
+                                          NestingLimit nestingLimit) {
+    const VariantSlot* last = 0;
+    for (const VariantSlot* slot = col.head(); slot; slot = slot->next()) {
+      if (!containsSlot(slot) || !_remainingSlots)
+        return DeserializationError::InvalidInput;
+      _remainingSlots--;
+      if (isObject ? !containsKey(slot) : slot->key() != 0)
+        return DeserializationError::InvalidInput;
+      DeserializationError err = validate(slot->data(), nestingLimit);
+      if (err)
+        return err;
+      last = slot;
+    }
+    return col.tail() == last ? DeserializationError::Ok
+                              : DeserializationError::InvalidInput;
+  }
+
+  bool containsString(const char* s, size_t n) const {
+    return _strings <= s && s <= _stringsEnd &&
+           n < size_t(_stringsEnd - s);  // n + 1 bytes, with the terminator
+  }
+
+  bool containsKey(const VariantSlot* slot) const {
+    const char* key = slot->key();
+    if (!slot->ownsKey() || key < _strings || key >= _stringsEnd)
+      return false;
+    const char* end =
+        static_cast<const char*>(memchr(key, 0, size_t(_stringsEnd - key)));
+    return end && slot->keySize() == size_t(end - key);
+  }
+
+  bool containsSlot(const VariantSlot* slot) const {
+    const char* p = reinterpret_cast<const char*>(slot);
+    return _variants <= p && p < _variantsEnd &&
+           size_t(p - _variants) % sizeof(VariantSlot) == 0;
+  }
+
+  const char* _strings;
+  const char* _stringsEnd;
+  const char* _variants;
+  const char* _variantsEnd;
+  size_t _remainingSlots;
+};
+
+inline DeserializationError validateImage(const void* image, size_t size,
+                                          NestingLimit nestingLimit) {
+  if (!image || size == 0)
+    return DeserializationError::EmptyInput;
+  if (size < sizeof(ImageHeader))
+    return DeserializationError::IncompleteInput;
+  if (!isAligned(image))
+    return DeserializationError::InvalidInput;
+  const ImageHeader* header = reinterpret_cast<const ImageHeader*>(image);
+  DeserializationError err = header->validate(size);
+  if (err)
+    return err;
+  return ImageValidator(header).validate(&header->root, nestingLimit);
+}
+
+// Copies an image created by serializeImage() into the document.
+// Every reference is checked before the copy, so a corrupted image returns
+// InvalidInput. The nesting limit protects the stack, like in deserializeJson().
+inline DeserializationError deserializeImage(
+    JsonDocument& doc, const void* image, size_t size,
+    NestingLimit nestingLimit = NestingLimit()) {
+  doc.clear();
+
+  DeserializationError err = validateImage(image, size, nestingLimit);
+  if (err)
+    return err;
+  const ImageHeader* header = reinterpret_cast<const ImageHeader*>(image);
+
+  MemoryPool& pool = doc.memoryPool();
+  if (!pool.canAlloc(header->stringsSize + header->variantsSize))
+    return DeserializationError::NoMemory;
+  char* strings = pool.allocStringZone(header->stringsSize);
+  char* variants = reinterpret_cast<char*>(
+      pool.allocVariants(header->variantsSize / sizeof(VariantSlot)));
+  ARDUINOJSON_ASSERT(strings && variants);
+
+  memcpy(strings, header->strings(), header->stringsSize);
+  memcpy(variants, header->variants(), header->variantsSize);
+
+  // The references are relative, so this only walks the tree if the gap
+  // between the strings and the variants differs from the image
+  ptrdiff_t rootDistance = reinterpret_cast<char*>(&doc.data()) -
+                           reinterpret_cast<const char*>(&header->root);
+  doc.data() = header->root;
+  doc.data().movePointers(strings - header->strings() - rootDistance,
+                          variants - header->variants() - rootDistance);
+
+  return DeserializationError::Ok;
+}
+
+// Gives read-only access to an image without copying it, for example to a
+// memory-mapped file.
+// The image is checked like in deserializeImage(), and must remain in memory
+// while the variant is in use.
+inline DeserializationError viewImage(
+    VariantConstRef& variant, const void* image, size_t size,
+    NestingLimit nestingLimit = NestingLimit()) {
+  variant = VariantConstRef();
+
+  DeserializationError err = validateImage(image, size, nestingLimit);
+  if (err)
+    return err;
+
+  variant = VariantConstRef(&reinterpret_cast<const ImageHeader*>(image)->root);
+  return DeserializationError::Ok;
+}
+
+}  // namespace ARDUINOJSON_NAMESPACE
@@ -0,0 +1,755 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Image/ImageHeader.hpp>
+#include <ArduinoJson/Numbers/FloatTraits.hpp>
+#include <ArduinoJson/Numbers/parseNumber.hpp>
+#include <ArduinoJson/Variant/VariantRef.hpp>
+
+#if ARDUINOJSON_HAS_CONSTEVAL
+
+#  include <stddef.h>  // offsetof
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// The JSON literal, passed as a template argument
+template <size_t N>
+struct JsonLiteralString {
+  consteval JsonLiteralString(const char (&s)[N]) {
+    for (size_t i = 0; i < N; i++)
+      chars[i] = s[i];
+  }
+
+  char chars[N] = {};
+};
+
+// Stops the compilation when a JSON literal is invalid: this function isn't
+// constexpr, so the compiler rejects the call and shows the reason.
+inline void invalidJsonLiteral(const char *) {}
+
+constexpr size_t alignImageOffset(size_t offset, size_t alignment) {
+  return (offset + alignment - 1) / alignment * alignment;
+}
+
+// Writes the image of a JSON literal during constant evaluation, with the
+// same layout as serializeImage() (see ImageHeader.hpp).
+// The parser accepts the same syntax as deserializeJson(), except comments,
+// and rejects duplicate keys.
+// With a null image, it only computes the size of the strings and the number
+// of slots.
+class JsonLiteralBuilder {
+ public:
+  constexpr JsonLiteralBuilder(const char *json, unsigned char *image,
+                               size_t stringsSize)
+      : _json(json),
+        _image(image),
+        _strings(sizeof(ImageHeader)),
+        _variants(padding(sizeof(ImageHeader) + stringsSize)),
+        _slotCount(0) {}
+
+  constexpr void build() {
+    parseVariant(offsetof(ImageHeader, root), 0);
+    skipSpaces();
+    if (*_json)
+      invalidJsonLiteral("unexpected character after the value");
+    if (_image)
+      writeHeader();
+  }
+
+  constexpr size_t stringsSize() const {
+    return _strings - sizeof(ImageHeader);
+  }
+
+  constexpr size_t slotCount() const {
+    return _slotCount;
+  }
+
+  static constexpr size_t imageSize(size_t stringsSize, size_t slotCount) {
+    return padding(sizeof(ImageHeader) + stringsSize) +
+           slotCount * sizeof(VariantSlot);
+  }
+
+  // Where the fields of VariantSlot and VariantData are, according to the
+  // usual layout rules. The static_asserts below verify the sizes.
+  static constexpr size_t flagsOffset = sizeof(VariantContent);
+  static constexpr size_t keyHashOffset = flagsOffset + 1;
+  static constexpr size_t keySizeOffset = alignImageOffset(
+      keyHashOffset + ARDUINOJSON_SLOT_KEY_HASH, alignof(uint16_t));
+  static constexpr size_t nextOffset = alignImageOffset(
+      ARDUINOJSON_SLOT_KEY_SIZE ? keySizeOffset + sizeof(uint16_t)
+                                : keyHashOffset + ARDUINOJSON_SLOT_KEY_HASH,
+      alignof(VariantSlotDiff));
+  static constexpr size_t keyOffset = alignImageOffset(
+      nextOffset + sizeof(VariantSlotDiff), alignof(ptrdiff_t));
+  static constexpr size_t tailOffset = sizeof(ptrdiff_t);
+  static constexpr size_t stringSizeOffset =
+      alignImageOffset(sizeof(ptrdiff_t), alignof(size_t));
+
+ private:
+  typedef FloatTraits<Float> traits;
+  typedef choose_largest<traits::mantissa_type, UInt>::type mantissa_t;
+
+  static constexpr size_t padding(size_t bytes) {
+#  if ARDUINOJSON_ENABLE_ALIGNMENT
+    return alignImageOffset(bytes, sizeof(void *));
+#  else
+    return bytes;
+#  endif
+  }
+
+  constexpr void parseVariant(size_t variant, uint8_t keyBit) {
+    skipSpaces();
+
+    switch (*_json) {
+      case '[':
+        parseArray(variant, keyBit);
+        break;
+
+      case '{':
+        parseObject(variant, keyBit);
+        break;
+
+      case '\"':
+      case '\'': {
+        size_t size = 0;
+        size_t string = parseQuotedString(size);
+        setFlags(variant, VALUE_IS_OWNED_STRING | keyBit);
+        writeSigned(variant, string, variant);
+        writeUnsigned(variant + stringSizeOffset, size, sizeof(size_t));
+        break;
+      }
+
+      default:
+        parseNumericValue(variant, keyBit);
+    }
+  }
+
+  constexpr void parseArray(size_t variant, uint8_t keyBit) {
+    _json++;  // '['
+    size_t head = 0, tail = 0;
+
+    skipSpaces();
+    if (!eat(']')) {
+      for (;;) {
+        size_t slot = addSlot(tail);
+        if (!head)
+          head = slot;
+        parseVariant(slot, 0);
+        tail = slot;
+
+        skipSpaces();
+        if (eat(']'))
+          break;
+        if (!eat(','))
+          invalidJsonLiteral("expected ',' or ']'");
+      }
+    }
+
+    setCollection(variant, VALUE_IS_ARRAY | keyBit, head, tail);
+  }
+
+  constexpr void parseObject(size_t variant, uint8_t keyBit) {
+    _json++;  // '{'
+    size_t head = 0, tail = 0;
+
+    skipSpaces();
+    if (!eat('}')) {
+      for (;;) {
+        size_t key = parseKey();
+        if (_image && findKey(head, key))
+          invalidJsonLiteral("duplicate key");
+
+        size_t slot = addSlot(tail);
+        if (!head)
+          head = slot;
+        writeSigned(slot + keyOffset, key, slot);
+#  if ARDUINOJSON_SLOT_KEY_HASH
+        writeUnsigned(slot + keyHashOffset, hashString(key), 1);
+#  endif
+#  if ARDUINOJSON_SLOT_KEY_SIZE
+        writeUnsigned(slot + keySizeOffset, keySize(key), sizeof(uint16_t));
+#  endif
+
+        skipSpaces();
+        if (!eat(':'))
+          invalidJsonLiteral("expected ':'");
+
+        parseVariant(slot, OWNED_KEY_BIT);
+        tail = slot;
+
+        skipSpaces();
+        if (eat('}'))
+          break;
+        if (!eat(','))
+          invalidJsonLiteral("expected ',' or '}'");
+        skipSpaces();
+      }
+    }
+
+    setCollection(variant, VALUE_IS_OBJECT | keyBit, head, tail);
+  }
+
+  constexpr size_t parseKey() {
+    if (*_json == '\"' || *_json == '\'') {
+      size_t size = 0;
+      return parseQuotedString(size);
+    }
+
+    // Unquoted key
+    size_t key = _strings;
+    if (!canBeInNonQuotedString(*_json))
+      invalidJsonLiteral("invalid key");
+    while (canBeInNonQuotedString(*_json))
+      appendChar(*_json++);
+    appendChar(0);
+    return key;
+  }
+
+  constexpr size_t parseQuotedString(size_t &size) {
+    const char stopChar = *_json++;
+    size_t string = _strings;
+    uint16_t highSurrogate = 0;
+
+    for (;;) {
+      char c = *_json++;
+      if (c == stopChar)
+        break;
+
+      if (c == '\0')
+        invalidJsonLiteral("unterminated string");
+
+      if (c == '\\') {
+        c = *_json;
+
+        if (c == 'u') {
+#  if ARDUINOJSON_DECODE_UNICODE
+          _json++;
+          uint16_t codeunit = parseHex4();
+          if (codeunit >= 0xD800 && codeunit < 0xDC00) {
+            highSurrogate = codeunit & 0x3FF;
+          } else if (codeunit >= 0xDC00 && codeunit < 0xE000) {
+            appendCodepoint(0x10000 +
+                            ((uint32_t(highSurrogate) << 10) |
+                             (codeunit & 0x3FF)));
+          } else {
+            appendCodepoint(codeunit);
+          }
+#  else
+          appendChar('\\');
+#  endif
+          continue;
+        }
+
+        c = unescapeChar(c);
+        if (c == '\0')
+          invalidJsonLiteral("invalid escape sequence");
+        _json++;
+      }
+
+      appendChar(c);
+    }
+
+    size = _strings - string;
+    appendChar(0);
+    return string;
+  }
+
+  constexpr uint16_t parseHex4() {
+    uint16_t result = 0;
+    for (int i = 0; i < 4; i++) {
+      char c = *_json++;
+      if (c >= '0' && c <= '9')
+        result = uint16_t(result * 16 + (c - '0'));
+      else if (c >= 'a' && c <= 'f')
+        result = uint16_t(result * 16 + (c - 'a' + 10));
+      else if (c >= 'A' && c <= 'F')
+        result = uint16_t(result * 16 + (c - 'A' + 10));
+      else
+        invalidJsonLiteral("invalid \\u escape sequence");
+    }
+    return result;
+  }
+
+  // Same as EscapeSequence::unescapeChar()
+  static constexpr char unescapeChar(char c) {
+    switch (c) {
+      case '/':
+      case '\"':
+      case '\\':
+        return c;
+      case 'b':
+        return '\b';
+      case 'f':
+        return '\f';
+      case 'n':
+        return '\n';
+      case 'r':
+        return '\r';
+      case 't':
+        return '\t';
+      default:
+        return '\0';
+    }
+  }
+
+  // Same as Utf8::encodeCodepoint()
+  constexpr void appendCodepoint(uint32_t codepoint) {
+    if (codepoint < 0x80) {
+      appendChar(char(codepoint));
+    } else if (codepoint < 0x800) {
+      appendChar(char(0xC0 | (codepoint >> 6)));
+      appendChar(char(0x80 | (codepoint & 0x3F)));
+    } else if (codepoint < 0x10000) {
+      appendChar(char(0xE0 | (codepoint >> 12)));
+      appendChar(char(0x80 | ((codepoint >> 6) & 0x3F)));
+      appendChar(char(0x80 | (codepoint & 0x3F)));
+    } else {
+      appendChar(char(0xF0 | (codepoint >> 18)));
+      appendChar(char(0x80 | ((codepoint >> 12) & 0x3F)));
+      appendChar(char(0x80 | ((codepoint >> 6) & 0x3F)));
+      appendChar(char(0x80 | (codepoint & 0x3F)));
+    }
+  }
+
+  constexpr void parseNumericValue(size_t variant, uint8_t keyBit) {
+    const char *begin = _json;
+    while (canBeInNonQuotedString(*_json))
+      _json++;
+    const char *end = _json;
+
+    if (begin == end)
+      invalidJsonLiteral("unexpected character");
+
+    if (equals(begin, end, "true")) {
+      setFlags(variant, VALUE_IS_BOOLEAN | keyBit);
+      writeUnsigned(variant, 1, sizeof(bool));
+    } else if (equals(begin, end, "false")) {
+      setFlags(variant, VALUE_IS_BOOLEAN | keyBit);
+    } else if (equals(begin, end, "null")) {
+      setFlags(variant, VALUE_IS_NULL | keyBit);
+    } else {
+      parseNumber(begin, end, variant, keyBit);
+    }
+  }
+
+  // Same as parseNumber() in parseNumber.hpp, except NaN and Infinity
+  constexpr void parseNumber(const char *s, const char *end, size_t variant,
+                             uint8_t keyBit) {
+    bool isNegative = false;
+    if (s < end && *s == '-') {
+      isNegative = true;
+      s++;
+    } else if (s < end && *s == '+') {
+      s++;
+    }
+
+    if (s == end || (!isDigit(*s) && *s != '.'))
+      invalidJsonLiteral("invalid value");
+
+    mantissa_t mantissa = 0;
+    int exponentOffset = 0;
+    const mantissa_t maxUint = UInt(-1);
+
+    while (s < end && isDigit(*s)) {
+      uint8_t digit = uint8_t(*s - '0');
+      if (mantissa > maxUint / 10)
+        break;
+      mantissa *= 10;
+      if (mantissa > maxUint - digit)
+        break;
+      mantissa += digit;
+      s++;
+    }
+
+    if (s == end) {
+      if (isNegative) {
+        const mantissa_t sintMantissaMax = mantissa_t(1)
+                                           << (sizeof(Integer) * 8 - 1);
+        if (mantissa <= sintMantissaMax) {
+          setFlags(variant, VALUE_IS_SIGNED_INTEGER | keyBit);
+          writeUnsigned(variant, ~mantissa + 1, sizeof(Integer));
+          return;
+        }
+      } else {
+        setFlags(variant, VALUE_IS_UNSIGNED_INTEGER | keyBit);
+        writeUnsigned(variant, mantissa, sizeof(UInt));
+        return;
+      }
+    }
+
+    // avoid mantissa overflow
+    while (mantissa > traits::mantissa_max) {
+      mantissa /= 10;
+      exponentOffset++;
+    }
+
+    // remaing digits can't fit in the mantissa
+    while (s < end && isDigit(*s)) {
+      exponentOffset++;
+      s++;
+    }
+
+    if (s < end && *s == '.') {
+      s++;
+      while (s < end && isDigit(*s)) {
+        if (mantissa < traits::mantissa_max / 10) {
+          mantissa = mantissa * 10 + uint8_t(*s - '0');
+          exponentOffset--;
+        }
+        s++;
+      }
+    }
+
+    int exponent = 0;
+    if (s < end && (*s == 'e' || *s == 'E')) {
+      s++;
+      bool negativeExponent = false;
+      if (s < end && *s == '-') {
+        negativeExponent = true;
+        s++;
+      } else if (s < end && *s == '+') {
+        s++;
+      }
+
+      while (s < end && isDigit(*s)) {
+        exponent = exponent * 10 + (*s - '0');
+        if (exponent + exponentOffset > traits::exponent_max) {
+          setFloat(variant, keyBit, isNegative, 0, !negativeExponent);
+          return;
+        }
+        s++;
+      }
+      if (negativeExponent)
+        exponent = -exponent;
+    }
+    exponent += exponentOffset;
+
+    // we should be at the end of the string, otherwise it's an error
+    if (s != end)
+      invalidJsonLiteral("invalid value");
+
+    setFloat(variant, keyBit, isNegative,
+             makeFloat(static_cast<Float>(mantissa), exponent), false);
+  }
+
+  // Same as FloatTraits::make_float()
+  static constexpr Float makeFloat(Float m, int e) {
+    const bool positive = e > 0;
+    if (!positive)
+      e = -e;
+    for (int index = 0; e != 0; index++) {
+      if (e & 1) {
+        Float factor = powerOfTen(index, positive);
+        if (positive && m > highestFloat() / factor)
+          invalidJsonLiteral("number out of range");
+        m *= factor;
+      }
+      e >>= 1;
+    }
+    return m;
+  }
+
+  // Same values as FloatTraits::positiveBinaryPowerOfTen() and
+  // negativeBinaryPowerOfTen()
+  static constexpr Float powerOfTen(int index, bool positive) {
+    if constexpr (sizeof(Float) == 8) {
+      constexpr double positives[] = {1e1,  1e2,  1e4,   1e8,  1e16,
+                                      1e32, 1e64, 1e128, 1e256};
+      constexpr double negatives[] = {1e-1,  1e-2,  1e-4,   1e-8,  1e-16,
+                                      1e-32, 1e-64, 1e-128, 1e-256};
+      return positive ? positives[index] : negatives[index];
+    } else {
+      constexpr float positives[] = {1e1f, 1e2f, 1e4f, 1e8f, 1e16f, 1e32f};
+      constexpr float negatives[] = {1e-1f,  1e-2f,  1e-4f,
+                                     1e-8f, 1e-16f, 1e-32f};
+      return positive ? positives[index] : negatives[index];
+    }
+  }
+
+  static constexpr Float highestFloat() {
+    if constexpr (sizeof(Float) == 8)
+      return 1.7976931348623157e308;
+    else
+      return 3.40282347e+38f;
+  }
+
+  constexpr void setFloat(size_t variant, uint8_t keyBit, bool isNegative,
+                          Float magnitude, bool isInfinite) {
+    const int mantissaBits = traits::mantissa_bits;
+    const int exponentBias = sizeof(Float) == 8 ? 1023 : 127;
+    const int exponentMax = 2 * exponentBias + 1;
+
+    mantissa_t bits = 0;
+    if (isInfinite) {
+      bits = mantissa_t(exponentMax) << mantissaBits;
+    } else if (magnitude != 0) {
+      // Normalize in [1;2), these operations are exact
+      Float m = magnitude;
+      int exponent = 0;
+      while (m >= 2) {
+        m /= 2;
+        exponent++;
+      }
+      while (m < 1) {
+        m *= 2;
+        exponent--;
+      }
+      if (exponent + exponentBias > 0) {
+        bits = mantissa_t(exponent + exponentBias) << mantissaBits;
+        bits |= mantissa_t((m - 1) * powerOfTwo(mantissaBits));
+      } else {  // subnormal
+        m = magnitude;
+        for (int i = 0; i < exponentBias - 1 + mantissaBits; i++)
+          m *= 2;
+        bits = mantissa_t(m);
+      }
+    }
+    if (isNegative)
+      bits |= mantissa_t(1) << (sizeof(Float) * 8 - 1);
+
+    setFlags(variant, VALUE_IS_FLOAT | keyBit);
+    writeUnsigned(variant, bits, sizeof(Float));
+  }
+
+  static constexpr Float powerOfTwo(int n) {
+    Float result = 1;
+    while (n--)
+      result *= 2;
+    return result;
+  }
+
+  constexpr size_t addSlot(size_t previous) {
+    size_t slot = _variants + _slotCount * sizeof(VariantSlot);
+    _slotCount++;
+    if (previous) {
+      const size_t maxDistance =
+          (size_t(1) << (sizeof(VariantSlotDiff) * 8 - 1)) - 1;
+      size_t distance = (slot - previous) / sizeof(VariantSlot);
+      if (distance > maxDistance)
+        invalidJsonLiteral("too many values");
+      writeUnsigned(previous + nextOffset, distance, sizeof(VariantSlotDiff));
+    }
+    return slot;
+  }
+
+  // Tells whether a member of the object (given by its first slot) has the
+  // key; only works when the image is written
+  constexpr bool findKey(size_t slot, size_t key) const {
+    while (slot) {
+      size_t other = slot + readSigned(slot + keyOffset, sizeof(ptrdiff_t));
+      if (stringEquals(other, key))
+        return true;
+      size_t distance = readSigned(slot + nextOffset, sizeof(VariantSlotDiff));
+      slot = distance ? slot + distance * sizeof(VariantSlot) : 0;
+    }
+    return false;
+  }
+
+#  if ARDUINOJSON_SLOT_KEY_SIZE
+  // Same as VariantSlot::keySize(), but needs the image, like hashString()
+  constexpr uint16_t keySize(size_t string) const {
+    if (!_image)
+      return 0;
+    size_t n = 0;
+    while (_image[string + n])
+      n++;
+    return uint16_t(n < VariantSlot::keySizeOverflow
+                        ? n
+                        : VariantSlot::keySizeOverflow);
+  }
+#  endif
+
+  // Same as stringHash(), but needs the image, so it returns 0 when measuring
+  constexpr uint8_t hashString(size_t string) const {
+    if (!_image)
+      return 0;
+    uint32_t hash = 2166136261UL;
+    for (size_t i = string; _image[i]; i++) {
+      hash ^= _image[i];
+      hash *= 16777619UL;
+    }
+    return static_cast<uint8_t>(hash ^ (hash >> 8) ^ (hash >> 16) ^
+                                (hash >> 24));
+  }
+
+  constexpr bool stringEquals(size_t a, size_t b) const {
+    while (_image[a] == _image[b]) {
+      if (_image[a] == 0)
+        return true;
+      a++;
+      b++;
+    }
+    return false;
+  }
+
+  constexpr void setFlags(size_t variant, uint8_t flags) {
+    writeUnsigned(variant + flagsOffset, flags, 1);
+  }
+
+  constexpr void setCollection(size_t variant, uint8_t flags, size_t head,
+                               size_t tail) {
+    setFlags(variant, flags);
+    if (head) {
+      writeSigned(variant, head, variant);
+      writeSigned(variant + tailOffset, tail, variant);
+    }
+  }
+
+  // Same as ImageHeader::init()
+  constexpr void writeHeader() {
+    const char magic[] = "AJIM";
+    for (size_t i = 0; i < 4; i++)
+      writeUnsigned(offsetof(ImageHeader, magic) + i, uint8_t(magic[i]), 1);
+
+    // Same as ImageHeader::getAbi()
+    const uint8_t abi[] = {ARDUINOJSON_IMAGE_VERSION,
+                           sizeof(void *),
+                           sizeof(VariantSlot),
+                           sizeof(Float),
+                           sizeof(Integer),
+                           ARDUINOJSON_SLOT_OFFSET_SIZE |
+                               (ARDUINOJSON_SLOT_KEY_HASH << 4) |
+                               (ARDUINOJSON_SLOT_KEY_SIZE << 5),
+                           ARDUINOJSON_LITTLE_ENDIAN,
+                           ARDUINOJSON_ENABLE_ALIGNMENT};
+    for (size_t i = 0; i < sizeof(abi); i++)
+      writeUnsigned(offsetof(ImageHeader, abi) + i, abi[i], 1);
+
+    writeUnsigned(offsetof(ImageHeader, stringsSize), stringsSize(),
+                  sizeof(size_t));
+    writeUnsigned(offsetof(ImageHeader, variantsSize),
+                  _slotCount * sizeof(VariantSlot), sizeof(size_t));
+  }
+
+  // Writes the distance from base to target, see RelativePointer.hpp
+  constexpr void writeSigned(size_t position, size_t target, size_t base) {
+    writeUnsigned(position, mantissa_t(target) - mantissa_t(base),
+                  sizeof(ptrdiff_t));
+  }
+
+  constexpr void writeUnsigned(size_t position, mantissa_t value,
+                               size_t size) {
+    if (!_image)
+      return;
+    for (size_t i = 0; i < size; i++) {
+      size_t index = ARDUINOJSON_LITTLE_ENDIAN ? i : size - 1 - i;
+      _image[position + index] = uint8_t(value >> (8 * i));
+    }
+  }
+
+  // Reads a positive distance written by writeSigned() or addSlot()
+  constexpr size_t readSigned(size_t position, size_t size) const {
+    size_t value = 0;
+    for (size_t i = 0; i < size; i++) {
+      size_t index = ARDUINOJSON_LITTLE_ENDIAN ? i : size - 1 - i;
+      value |= size_t(_image[position + index]) << (8 * i);
+    }
+    return value;
+  }
+
+  constexpr void appendChar(char c) {
+    if (_image)
+      _image[_strings] = static_cast<unsigned char>(c);
+    _strings++;
+  }
+
+  constexpr void skipSpaces() {
+    while (*_json == ' ' || *_json == '\t' || *_json == '\r' ||
+           *_json == '\n')
+      _json++;
+  }
+
+  constexpr bool eat(char c) {
+    if (*_json != c)
+      return false;
+    _json++;
+    return true;
+  }
+
+  static constexpr bool equals(const char *begin, const char *end,
+                               const char *expected) {
+    while (begin < end && *expected && *begin == *expected) {
+      begin++;
+      expected++;
+    }
+    return begin == end && *expected == 0;
+  }
+
+  static constexpr bool isDigit(char c) {
+    return c >= '0' && c <= '9';
+  }
+
+  // Same as JsonDeserializer::canBeInNonQuotedString()
+  static constexpr bool canBeInNonQuotedString(char c) {
+    return isDigit(c) || (c >= '_' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+           c == '+' || c == '-' || c == '.';
+  }
+
+  const char *_json;
+  unsigned char *_image;
+  size_t _strings;   // position of the next string
+  size_t _variants;  // position of the first slot
+  size_t _slotCount;
+};
+
+static_assert(alignImageOffset(JsonLiteralBuilder::keyOffset +
+                                   sizeof(ptrdiff_t),
+                               alignof(VariantSlot)) == sizeof(VariantSlot),
+              "unexpected layout of VariantSlot");
+static_assert(alignImageOffset(JsonLiteralBuilder::flagsOffset + 1,
+                               alignof(VariantData)) == sizeof(VariantData),
+              "unexpected layout of VariantData");
+
+template <size_t N>
+struct JsonLiteralImage {
+  alignas(ImageHeader) alignas(VariantSlot) unsigned char bytes[N];
+};
+
+struct JsonLiteralSize {
+  size_t strings;
+  size_t slots;
+};
+
+template <JsonLiteralString json>
+consteval JsonLiteralSize measureJsonLiteral() {
+  JsonLiteralBuilder builder(json.chars, 0, 0);
+  builder.build();
+  return JsonLiteralSize{builder.stringsSize(), builder.slotCount()};
+}
+
+template <JsonLiteralString json>
+consteval auto makeJsonLiteralImage() {
+  constexpr JsonLiteralSize size = measureJsonLiteral<json>();
+  JsonLiteralImage<JsonLiteralBuilder::imageSize(size.strings, size.slots)>
+      image{};
+  JsonLiteralBuilder builder(json.chars, image.bytes, size.strings);
+  builder.build();
+  return image;
+}
+
+// The image of a JSON literal, built at compile time.
+// It can be passed to viewImage() or saved like the output of
+// serializeImage().
+template <JsonLiteralString json>
+inline constexpr auto jsonLiteralImage = makeJsonLiteralImage<json>();
+
+// Parses a JSON literal at compile time and returns a read-only view of the
+// result, without parsing or allocating anything at run time:
+//
+//   JsonVariantConst config = jsonLiteral<R"({"port":80,"hosts":["a"]})">();
+//
+// The image is a constant, so it goes in flash or in .rodata.
+// An invalid literal stops the compilation, in invalidJsonLiteral().
+// Requires C++20.
+template <JsonLiteralString json>
+inline VariantConstRef jsonLiteral() {
+  const unsigned char *image = jsonLiteralImage<json>.bytes;
+  return VariantConstRef(&reinterpret_cast<const ImageHeader *>(image)->root);
+}
+
+}  // namespace ARDUINOJSON_NAMESPACE
+
+#endif
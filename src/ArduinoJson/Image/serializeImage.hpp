@@ -0,0 +1,89 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Document/JsonDocument.hpp>
+#include <ArduinoJson/Image/ImageHeader.hpp>
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// An image can only contain references to its own memory pool
+inline bool variantIsSelfContained(const VariantData& variant) {
+  switch (variant.type()) {
+    case VALUE_IS_LINKED_STRING:
+    case VALUE_IS_LINKED_RAW:
+    case VALUE_IS_LINKED_BINARY:
+    case VALUE_IS_LINKED_EXTENSION:
+    case VALUE_IS_POINTER:
+      return false;
+
+    case VALUE_IS_ARRAY:
+    case VALUE_IS_OBJECT:
+      for (const VariantSlot* slot = variant.asCollection()->head(); slot;
+           slot = slot->next()) {
+        if (slot->key() && !slot->ownsKey())
+          return false;
+        if (!variantIsSelfContained(*slot->data()))
+          return false;
+      }
+      return true;
+
+    default:
+      return true;
+  }
+}
+
+// Returns the size of the image of the document, or 0 if the document refers
+// to strings or variants that are not in its memory pool
+inline size_t measureImage(const JsonDocument& doc) {
+  if (!variantIsSelfContained(doc.data()))
+    return 0;
+
+  const char* zone;
+  size_t stringsSize, variantsSize;
+  doc.memoryPool().getStringZone(&zone, &stringsSize);
+  doc.memoryPool().getVariantZone(&zone, &variantsSize);
+  return addPadding(sizeof(ImageHeader) + stringsSize) + variantsSize;
+}
+
+// Copies the memory pool of the document to the buffer.
+// Returns the number of bytes written, or 0 if the document cannot be imaged
+// (see measureImage()) or if the buffer is too small or misaligned.
+inline size_t serializeImage(const JsonDocument& doc, void* buffer,
+                             size_t bufferSize) {
+  size_t imageSize = measureImage(doc);
+  if (!imageSize || imageSize > bufferSize || !isAligned(buffer))
+    return 0;
+
+  const char *strings, *variants;
+  size_t stringsSize, variantsSize;
+  doc.memoryPool().getStringZone(&strings, &stringsSize);
+  doc.memoryPool().getVariantZone(&variants, &variantsSize);
+
+  // The padding is zeroed, so the image only depends on the document
+  ImageHeader* header = reinterpret_cast<ImageHeader*>(buffer);
+  memset(header, 0, sizeof(ImageHeader));
+  header->init(stringsSize, variantsSize);
+
+  char* imageStrings = reinterpret_cast<char*>(buffer) + sizeof(ImageHeader);
+  char* imageVariants = reinterpret_cast<char*>(buffer) +
+                        header->variantsOffset();
+  memcpy(imageStrings, strings, stringsSize);
+  memset(imageStrings + stringsSize, 0,
+         size_t(imageVariants - imageStrings) - stringsSize);
+  memcpy(imageVariants, variants, variantsSize);
+
+  // The variants and the strings are now closer to each other than in the
+  // pool, so this walks the tree to fix the references between them
+  ptrdiff_t rootDistance = reinterpret_cast<const char*>(&header->root) -
+                           reinterpret_cast<const char*>(&doc.data());
+  header->root.assignZeroPadded(doc.data());
+  header->root.movePointers(imageStrings - strings - rootDistance,
+                            imageVariants - variants - rootDistance);
+
+  return imageSize;
+}
+
+}  // namespace ARDUINOJSON_NAMESPACE
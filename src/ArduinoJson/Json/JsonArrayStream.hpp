@@ -0,0 +1,205 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Document/JsonDocument.hpp>
+#include <ArduinoJson/Json/JsonDeserializer.hpp>
+#include <ArduinoJson/Json/StreamIterator.hpp>
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// Deserializes the elements of a JSON array one at a time, reusing the same
+// JsonDocument. The document only needs to be big enough for the largest
+// element, not for the whole array.
+//
+//   auto stream = streamJsonArray(doc, input);
+//   for (JsonDocument& element : stream) {
+//     // ...
+//   }
+//   if (stream.error()) ...
+//
+// Without C++11, call next() until it returns false.
+//
+// The filter and the nesting limit apply to each element. Strings are always
+// copied into the document, since the document is reused.
+// The input must outlive the stream.
+template <typename TReader, typename TFilter>
+class JsonArrayStream : private JsonDeserializer<TReader, StringCopier> {
+  typedef JsonDeserializer<TReader, StringCopier> base;
+
+ public:
+  typedef StreamIterator<JsonArrayStream, JsonDocument> iterator;
+
+  JsonArrayStream(JsonDocument &doc, TReader reader, TFilter filter,
+                  NestingLimit nestingLimit)
+      : base(doc.memoryPool(), reader, StringCopier(doc.memoryPool())),
+        _doc(&doc),
+        _filter(filter),
+        _nestingLimit(nestingLimit),
+        _state(BeforeArray) {}
+
+  // Deserializes the next element in the document.
+  // Returns false at the end of the array, or in case of error.
+  bool next() {
+    if (_state == Ended)
+      return false;
+
+    _doc->clear();
+
+    if (!base::skipSpacesAndComments())
+      return stop();
+
+    if (_state == BeforeArray) {
+      if (!base::eat('['))
+        return stop(DeserializationError::InvalidInput);
+
+      if (_nestingLimit.reached())
+        return stop(DeserializationError::TooDeep);
+
+      if (!base::skipSpacesAndComments())
+        return stop();
+
+      if (base::eat(']'))
+        return stop(DeserializationError::Ok);
+    } else {
+      if (base::eat(']'))
+        return stop(DeserializationError::Ok);
+
+      if (!base::eat(','))
+        return stop(DeserializationError::InvalidInput);
+    }
+
+    _state = InArray;
+
+    if (!base::parseVariant(_doc->data(), _filter,
+                            _nestingLimit.decrement()))
+      return stop();
+
+    return true;
+  }
+
+  // Returns Ok as long as no error occured.
+  // An empty input returns EmptyInput, like deserializeJson().
+  DeserializationError error() const {
+    return base::_error;
+  }
+
+  iterator begin() {
+    return iterator(next() ? this : 0);
+  }
+
+  iterator end() {
+    return iterator(0);
+  }
+
+ private:
+  friend class StreamIterator<JsonArrayStream, JsonDocument>;
+
+  enum State { BeforeArray, InArray, Ended };
+
+  JsonDocument &current() {
+    return *_doc;
+  }
+
+  bool stop() {
+    _state = Ended;
+    return false;
+  }
+
+  bool stop(DeserializationError error) {
+    base::_error = error;
+    return stop();
+  }
+
+  JsonDocument *_doc;
+  TFilter _filter;
+  NestingLimit _nestingLimit;
+  State _state;
+};
+
+//
+// streamJsonArray(JsonDocument&, const std::string&, ...)
+//
+// ... = NestingLimit
+template <typename TString>
+typename enable_if<!is_array<TString>::value,
+                   JsonArrayStream<Reader<TString>, AllowAllFilter> >::type
+streamJsonArray(JsonDocument &doc, const TString &input,
+                NestingLimit nestingLimit = NestingLimit()) {
+  return JsonArrayStream<Reader<TString>, AllowAllFilter>(
+      doc, Reader<TString>(input), AllowAllFilter(), nestingLimit);
+}
+// ... = Filter, NestingLimit
+template <typename TString>
+typename enable_if<!is_array<TString>::value,
+                   JsonArrayStream<Reader<TString>, Filter> >::type
+streamJsonArray(JsonDocument &doc, const TString &input, Filter filter,
+                NestingLimit nestingLimit = NestingLimit()) {
+  return JsonArrayStream<Reader<TString>, Filter>(doc, Reader<TString>(input),
+                                                  filter, nestingLimit);
+}
+
+//
+// streamJsonArray(JsonDocument&, std::istream&, ...)
+//
+// ... = NestingLimit
+template <typename TStream>
+JsonArrayStream<Reader<TStream>, AllowAllFilter> streamJsonArray(
+    JsonDocument &doc, TStream &input,
+    NestingLimit nestingLimit = NestingLimit()) {
+  return JsonArrayStream<Reader<TStream>, AllowAllFilter>(
+      doc, Reader<TStream>(input), AllowAllFilter(), nestingLimit);
+}
+// ... = Filter, NestingLimit
+template <typename TStream>
+JsonArrayStream<Reader<TStream>, Filter> streamJsonArray(
+    JsonDocument &doc, TStream &input, Filter filter,
+    NestingLimit nestingLimit = NestingLimit()) {
+  return JsonArrayStream<Reader<TStream>, Filter>(doc, Reader<TStream>(input),
+                                                  filter, nestingLimit);
+}
+
+//
+// streamJsonArray(JsonDocument&, char*, ...)
+//
+// ... = NestingLimit
+template <typename TChar>
+JsonArrayStream<Reader<TChar *>, AllowAllFilter> streamJsonArray(
+    JsonDocument &doc, TChar *input,
+    NestingLimit nestingLimit = NestingLimit()) {
+  return JsonArrayStream<Reader<TChar *>, AllowAllFilter>(
+      doc, Reader<TChar *>(input), AllowAllFilter(), nestingLimit);
+}
+// ... = Filter, NestingLimit
+template <typename TChar>
+JsonArrayStream<Reader<TChar *>, Filter> streamJsonArray(
+    JsonDocument &doc, TChar *input, Filter filter,
+    NestingLimit nestingLimit = NestingLimit()) {
+  return JsonArrayStream<Reader<TChar *>, Filter>(doc, Reader<TChar *>(input),
+                                                  filter, nestingLimit);
+}
+
+//
+// streamJsonArray(JsonDocument&, char*, size_t, ...)
+//
+// ... = NestingLimit
+template <typename TChar>
+JsonArrayStream<BoundedReader<TChar *>, AllowAllFilter> streamJsonArray(
+    JsonDocument &doc, TChar *input, size_t inputSize,
+    NestingLimit nestingLimit = NestingLimit()) {
+  return JsonArrayStream<BoundedReader<TChar *>, AllowAllFilter>(
+      doc, BoundedReader<TChar *>(input, inputSize), AllowAllFilter(),
+      nestingLimit);
+}
+// ... = Filter, NestingLimit
+template <typename TChar>
+JsonArrayStream<BoundedReader<TChar *>, Filter> streamJsonArray(
+    JsonDocument &doc, TChar *input, size_t inputSize, Filter filter,
+    NestingLimit nestingLimit = NestingLimit()) {
+  return JsonArrayStream<BoundedReader<TChar *>, Filter>(
+      doc, BoundedReader<TChar *>(input, inputSize), filter, nestingLimit);
+}
+
+}  // namespace ARDUINOJSON_NAMESPACE
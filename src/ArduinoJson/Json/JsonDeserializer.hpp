@@ -41,7 +41,7 @@ class JsonDeserializer {
     return _error;
   }
 
- private:
+ protected:
   char current() {
     return _latch.current();
   }
@@ -238,9 +238,9 @@ class JsonDeserializer {
       if (memberFilter.allow()) {
         VariantData *variant = object.getMember(adaptString(key.c_str()));
         if (!variant) {
-          // Save key in memory pool.
+          // Save key in memory pool, unless it's in the key dictionary.
           // This MUST be done before adding the slot.
-          key = _stringStorage.save();
+          key = _stringStorage.saveKey();
 
           // Allocate slot in object
           VariantSlot *slot = object.addSlot(_pool);
@@ -0,0 +1,242 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Document/JsonDocument.hpp>
+#include <ArduinoJson/Json/JsonDeserializer.hpp>
+#include <ArduinoJson/Json/StreamIterator.hpp>
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// Reads the members of a JSON object one at a time, reusing the same
+// JsonDocument. The document only needs to be big enough for the largest
+// member, not for the whole object.
+//
+//   auto stream = streamJsonObject(doc, input);
+//   for (auto& member : stream) {
+//     if (member.key() == "dev1")
+//       process(member.value());
+//     // other values are skipped without being deserialized
+//   }
+//   if (stream.error()) ...
+//
+// Without C++11, call next() until it returns false.
+//
+// The key and the value remain valid until the next call to next().
+// Members are not checked for duplicate keys.
+// The filter applies to the members, like in deserializeJson(), and the
+// nesting limit includes the object.
+// The input must outlive the stream.
+template <typename TReader, typename TFilter>
+class JsonObjectStream : private JsonDeserializer<TReader, StringCopier> {
+  typedef JsonDeserializer<TReader, StringCopier> base;
+
+ public:
+  typedef StreamIterator<JsonObjectStream, JsonObjectStream> iterator;
+
+  JsonObjectStream(JsonDocument &doc, TReader reader, TFilter filter,
+                   NestingLimit nestingLimit)
+      : base(doc.memoryPool(), reader, StringCopier(doc.memoryPool())),
+        _doc(&doc),
+        _filter(filter),
+        _nestingLimit(nestingLimit),
+        _state(BeforeObject) {}
+
+  // Reads the key of the next member.
+  // If the value of the current member wasn't read, it's skipped.
+  // Returns false at the end of the object, or in case of error.
+  bool next() {
+    if (_state == Ended)
+      return false;
+
+    if (_state == BeforeValue &&
+        !base::skipVariant(_nestingLimit.decrement()))
+      return stop();
+
+    _doc->clear();
+
+    if (!base::skipSpacesAndComments())
+      return stop();
+
+    if (_state == BeforeObject) {
+      if (!base::eat('{'))
+        return stop(DeserializationError::InvalidInput);
+
+      if (_nestingLimit.reached())
+        return stop(DeserializationError::TooDeep);
+
+      if (!base::skipSpacesAndComments())
+        return stop();
+
+      if (base::eat('}'))
+        return stop(DeserializationError::Ok);
+    } else {
+      if (base::eat('}'))
+        return stop(DeserializationError::Ok);
+
+      if (!base::eat(','))
+        return stop(DeserializationError::InvalidInput);
+
+      if (!base::skipSpacesAndComments())
+        return stop();
+    }
+
+    // The key is stored in the document, before the value
+    if (!base::parseKey())
+      return stop();
+    _key = base::_stringStorage.saveKey();
+
+    if (!base::skipSpacesAndComments())
+      return stop();
+
+    if (!base::eat(':'))
+      return stop(DeserializationError::InvalidInput);
+
+    _state = BeforeValue;
+    return true;
+  }
+
+  // The key of the current member
+  String key() const {
+    return _key;
+  }
+
+  // Deserializes the value of the current member in the document.
+  // The document is null if the filter rejects the member.
+  // In case of error, the value is incomplete; see error().
+  JsonDocument &value() {
+    if (_state == BeforeValue) {
+      _state = AfterValue;
+      if (!base::parseVariant(_doc->data(), _filter[_key.c_str()],
+                              _nestingLimit.decrement()))
+        stop();
+    }
+    return *_doc;
+  }
+
+  // Returns Ok as long as no error occured.
+  // An empty input returns EmptyInput, like deserializeJson().
+  DeserializationError error() const {
+    return base::_error;
+  }
+
+  iterator begin() {
+    return iterator(next() ? this : 0);
+  }
+
+  iterator end() {
+    return iterator(0);
+  }
+
+ private:
+  friend class StreamIterator<JsonObjectStream, JsonObjectStream>;
+
+  enum State { BeforeObject, BeforeValue, AfterValue, Ended };
+
+  JsonObjectStream &current() {
+    return *this;
+  }
+
+  bool stop() {
+    _state = Ended;
+    return false;
+  }
+
+  bool stop(DeserializationError error) {
+    base::_error = error;
+    return stop();
+  }
+
+  JsonDocument *_doc;
+  TFilter _filter;
+  NestingLimit _nestingLimit;
+  State _state;
+  String _key;
+};
+
+//
+// streamJsonObject(JsonDocument&, const std::string&, ...)
+//
+// ... = NestingLimit
+template <typename TString>
+typename enable_if<!is_array<TString>::value,
+                   JsonObjectStream<Reader<TString>, AllowAllFilter> >::type
+streamJsonObject(JsonDocument &doc, const TString &input,
+                 NestingLimit nestingLimit = NestingLimit()) {
+  return JsonObjectStream<Reader<TString>, AllowAllFilter>(
+      doc, Reader<TString>(input), AllowAllFilter(), nestingLimit);
+}
+// ... = Filter, NestingLimit
+template <typename TString>
+typename enable_if<!is_array<TString>::value,
+                   JsonObjectStream<Reader<TString>, Filter> >::type
+streamJsonObject(JsonDocument &doc, const TString &input, Filter filter,
+                 NestingLimit nestingLimit = NestingLimit()) {
+  return JsonObjectStream<Reader<TString>, Filter>(doc, Reader<TString>(input),
+                                                   filter, nestingLimit);
+}
+
+//
+// streamJsonObject(JsonDocument&, std::istream&, ...)
+//
+// ... = NestingLimit
+template <typename TStream>
+JsonObjectStream<Reader<TStream>, AllowAllFilter> streamJsonObject(
+    JsonDocument &doc, TStream &input,
+    NestingLimit nestingLimit = NestingLimit()) {
+  return JsonObjectStream<Reader<TStream>, AllowAllFilter>(
+      doc, Reader<TStream>(input), AllowAllFilter(), nestingLimit);
+}
+// ... = Filter, NestingLimit
+template <typename TStream>
+JsonObjectStream<Reader<TStream>, Filter> streamJsonObject(
+    JsonDocument &doc, TStream &input, Filter filter,
+    NestingLimit nestingLimit = NestingLimit()) {
+  return JsonObjectStream<Reader<TStream>, Filter>(doc, Reader<TStream>(input),
+                                                   filter, nestingLimit);
+}
+
+//
+// streamJsonObject(JsonDocument&, char*, ...)
+//
+// ... = NestingLimit
+template <typename TChar>
+JsonObjectStream<Reader<TChar *>, AllowAllFilter> streamJsonObject(
+    JsonDocument &doc, TChar *input,
+    NestingLimit nestingLimit = NestingLimit()) {
+  return JsonObjectStream<Reader<TChar *>, AllowAllFilter>(
+      doc, Reader<TChar *>(input), AllowAllFilter(), nestingLimit);
+}
+// ... = Filter, NestingLimit
+template <typename TChar>
+JsonObjectStream<Reader<TChar *>, Filter> streamJsonObject(
+    JsonDocument &doc, TChar *input, Filter filter,
+    NestingLimit nestingLimit = NestingLimit()) {
+  return JsonObjectStream<Reader<TChar *>, Filter>(doc, Reader<TChar *>(input),
+                                                   filter, nestingLimit);
+}
+
+//
+// streamJsonObject(JsonDocument&, char*, size_t, ...)
+//
+// ... = NestingLimit
+template <typename TChar>
+JsonObjectStream<BoundedReader<TChar *>, AllowAllFilter> streamJsonObject(
+    JsonDocument &doc, TChar *input, size_t inputSize,
+    NestingLimit nestingLimit = NestingLimit()) {
+  return JsonObjectStream<BoundedReader<TChar *>, AllowAllFilter>(
+      doc, BoundedReader<TChar *>(input, inputSize), AllowAllFilter(),
+      nestingLimit);
+}
+// ... = Filter, NestingLimit
+template <typename TChar>
+JsonObjectStream<BoundedReader<TChar *>, Filter> streamJsonObject(
+    JsonDocument &doc, TChar *input, size_t inputSize, Filter filter,
+    NestingLimit nestingLimit = NestingLimit()) {
+  return JsonObjectStream<BoundedReader<TChar *>, Filter>(
+      doc, BoundedReader<TChar *>(input, inputSize), filter, nestingLimit);
+}
+
+}  // namespace ARDUINOJSON_NAMESPACE
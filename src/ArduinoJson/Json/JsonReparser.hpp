@@ -0,0 +1,249 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Document/JsonDocument.hpp>
+#include <ArduinoJson/Json/JsonDeserializer.hpp>
+#include <ArduinoJson/StringStorage/StringCopier.hpp>
+
+#include <string.h>  // memcmp
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// Parses JSON into the variants of an existing document, which must have the
+// same structure: same types of containers, same number of elements, and same
+// keys in the same order. The keys are compared in the free zone of the pool,
+// but never saved; a string value is only saved if it changed.
+template <typename TReader>
+class JsonReparser : private JsonDeserializer<TReader, StringCopier> {
+  typedef JsonDeserializer<TReader, StringCopier> base;
+
+ public:
+  JsonReparser(MemoryPool &pool, TReader reader)
+      : base(pool, reader, StringCopier(pool)) {}
+
+  // Returns false if the input has a different structure, or if it's invalid;
+  // in both cases, some values may have been overwritten already.
+  bool reparse(VariantData &variant, NestingLimit nestingLimit) {
+    if (!reparseVariant(variant, nestingLimit))
+      return false;
+
+    // We don't detect trailing characters earlier, so we need to check now
+    return base::_latch.last() == 0 || variant.isEnclosed();
+  }
+
+ private:
+  bool reparseVariant(VariantData &variant, NestingLimit nestingLimit) {
+    if (!base::skipSpacesAndComments())
+      return false;
+
+    switch (base::current()) {
+      case '[':
+        return variant.isArray() &&
+               reparseArray(*variant.asArray(), nestingLimit);
+
+      case '{':
+        return variant.isObject() &&
+               reparseObject(*variant.asObject(), nestingLimit);
+
+      case '\"':
+      case '\'':
+        return !variant.isCollection() && reparseStringValue(variant);
+
+      default:
+        if (variant.isCollection())
+          return false;
+        variant.setNull();  // parseNumericValue() doesn't set null
+        return base::parseNumericValue(variant);
+    }
+  }
+
+  bool reparseArray(CollectionData &array, NestingLimit nestingLimit) {
+    if (nestingLimit.reached())
+      return false;
+
+    // Skip opening braket
+    base::move();
+
+    // Skip spaces
+    if (!base::skipSpacesAndComments())
+      return false;
+
+    VariantSlot *slot = array.head();
+
+    // Empty array?
+    if (base::eat(']'))
+      return slot == 0;
+
+    // Read each value
+    for (;;) {
+      // More elements than before?
+      if (!slot)
+        return false;
+
+      // 1 - Parse value
+      if (!reparseVariant(*slot->data(), nestingLimit.decrement()))
+        return false;
+      slot = slot->next();
+
+      // 2 - Skip spaces
+      if (!base::skipSpacesAndComments())
+        return false;
+
+      // 3 - More values?
+      if (base::eat(']'))
+        return slot == 0;
+      if (!base::eat(','))
+        return false;
+    }
+  }
+
+  bool reparseObject(CollectionData &object, NestingLimit nestingLimit) {
+    if (nestingLimit.reached())
+      return false;
+
+    // Skip opening brace
+    base::move();
+
+    // Skip spaces
+    if (!base::skipSpacesAndComments())
+      return false;
+
+    VariantSlot *slot = object.head();
+
+    // Empty object?
+    if (base::eat('}'))
+      return slot == 0;
+
+    // Read each key value pair
+    for (;;) {
+      // More members than before?
+      if (!slot)
+        return false;
+
+      // Parse key in the free zone, and compare with the existing one
+      if (!base::parseKey())
+        return false;
+      if (!isSameKey(slot))
+        return false;
+
+      // Skip spaces
+      if (!base::skipSpacesAndComments())
+        return false;
+
+      // Colon
+      if (!base::eat(':'))
+        return false;
+
+      // Parse value
+      if (!reparseVariant(*slot->data(), nestingLimit.decrement()))
+        return false;
+      slot = slot->next();
+
+      // Skip spaces
+      if (!base::skipSpacesAndComments())
+        return false;
+
+      // More keys/values?
+      if (base::eat('}'))
+        return slot == 0;
+      if (!base::eat(','))
+        return false;
+
+      // Skip spaces
+      if (!base::skipSpacesAndComments())
+        return false;
+    }
+  }
+
+  // A linked key may point to a stale input, unless it's in the dictionary
+  bool isSameKey(const VariantSlot *slot) {
+    String key = base::_stringStorage.str();
+    if (slot->ownsKey())
+      return key.size() == slot->keySize() &&
+             memcmp(key.c_str(), slot->key(), key.size()) == 0;
+    const JsonKeyDictionary *dictionary = base::_pool->keyDictionary();
+    return dictionary &&
+           dictionary->find(key.c_str(), key.size()) == slot->key();
+  }
+
+  bool reparseStringValue(VariantData &variant) {
+    base::_stringStorage.startString();
+    if (!base::parseQuotedString())
+      return false;
+
+    // Keep the existing copy if the value didn't change
+    String value = base::_stringStorage.str();
+    if (variant.type() == VALUE_IS_OWNED_STRING) {
+      String previous = variant.asString();
+      if (previous.size() == value.size() &&
+          memcmp(previous.c_str(), value.c_str(), value.size()) == 0)
+        return true;
+    }
+
+    variant.setString(base::_stringStorage.save());
+    return true;
+  }
+};
+
+template <typename TReader>
+DeserializationError reparse(JsonDocument &doc, TReader reader,
+                             NestingLimit nestingLimit) {
+  if (!doc.overflowed() &&
+      JsonReparser<TReader>(doc.memoryPool(), reader)
+          .reparse(doc.data(), nestingLimit))
+    return DeserializationError::Ok;
+
+  // Different structure or error: parse from scratch, copying the strings
+  // so that the next call can compare the keys
+  doc.clear();
+  return JsonDeserializer<TReader, StringCopier>(doc.memoryPool(), reader,
+                                                 StringCopier(doc.memoryPool()))
+      .parse(doc.data(), AllowAllFilter(), nestingLimit);
+}
+
+// Same as deserializeJson(), but optimized for a stream of messages with the
+// same structure: when the input has the same containers and the same keys
+// (in the same order) as the document, the values are overwritten in place.
+// No slot is allocated, no key is copied, and a string value is copied only
+// if it changed.
+// Any difference in the structure, or any error, triggers a full parse from
+// the beginning of the input, which is why the input can't be a stream.
+// Keys linked to the input (zero-copy mode) are never trusted, but keys
+// linked to the JsonKeyDictionary of the document are.
+// Changed strings leave their previous value in the pool; when the pool is
+// full, reparseJson() falls back to a full parse, which reclaims the space.
+
+//
+// reparseJson(JsonDocument&, const std::string&, ...)
+//
+template <typename TString>
+typename enable_if<IsString<TString>::value && !is_array<TString>::value,
+                   DeserializationError>::type
+reparseJson(JsonDocument &doc, const TString &input,
+            NestingLimit nestingLimit = NestingLimit()) {
+  return reparse(doc, Reader<TString>(input), nestingLimit);
+}
+
+//
+// reparseJson(JsonDocument&, char*, ...)
+//
+template <typename TChar>
+DeserializationError reparseJson(JsonDocument &doc, TChar *input,
+                                 NestingLimit nestingLimit = NestingLimit()) {
+  return reparse(doc, Reader<TChar *>(input), nestingLimit);
+}
+
+//
+// reparseJson(JsonDocument&, char*, size_t, ...)
+//
+template <typename TChar>
+DeserializationError reparseJson(JsonDocument &doc, TChar *input,
+                                 size_t inputSize,
+                                 NestingLimit nestingLimit = NestingLimit()) {
+  return reparse(doc, BoundedReader<TChar *>(input, inputSize), nestingLimit);
+}
+
+}  // namespace ARDUINOJSON_NAMESPACE
@@ -44,7 +44,7 @@ class JsonSerializer : public Visitor<size_t> {
     const VariantSlot *slot = object.head();
 
     while (slot != 0) {
-      _formatter.writeString(slot->key());
+      _formatter.writeString(slot->key(), slot->keySize());
       write(':');
       slot->data()->resolve()->accept(*this);
 
@@ -74,6 +74,17 @@ class JsonSerializer : public Visitor<size_t> {
     return bytesWritten();
   }
 
+  size_t visitBinary(const uint8_t *data, size_t n) {
+    _formatter.writeBinary(data, n);
+    return bytesWritten();
+  }
+
+  // The type code is lost
+  size_t visitExtension(int8_t, const uint8_t *data, size_t n) {
+    _formatter.writeBinary(data, n);
+    return bytesWritten();
+  }
+
   size_t visitRawJson(const char *data, size_t n) {
     _formatter.writeRaw(data, n);
     return bytesWritten();
@@ -112,6 +123,10 @@ class JsonSerializer : public Visitor<size_t> {
     _formatter.writeRaw(s);
   }
 
+  void write(const char *s, size_t n) {
+    _formatter.writeRaw(s, n);
+  }
+
  private:
   TextFormatter<TWriter> _formatter;
 };
@@ -0,0 +1,157 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Json/JsonSerializer.hpp>
+#include <ArduinoJson/Serialization/StreamWriterBuffer.hpp>
+#include <ArduinoJson/Serialization/StreamWriterState.hpp>
+#include <ArduinoJson/Serialization/writeValue.hpp>
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// Writes JSON directly to the destination, without building a JsonDocument.
+// The memory usage doesn't depend on the size of the output.
+//
+//   JsonStreamWriter<std::ostream> writer(std::cout);
+//   writer.beginObject();
+//   writer.key("values");
+//   writer.beginArray();
+//   writer.value(1);
+//   writer.value(doc["nested"]);  // any JsonVariantConst
+//   writer.endArray();
+//   writer.endObject();
+//
+// Each function returns false if the call would produce invalid JSON (value
+// where a key is expected, mismatched end, nesting deeper than maxDepth...)
+// After that, the writer ignores all the calls.
+template <typename TDestination,
+          size_t maxDepth = ARDUINOJSON_DEFAULT_NESTING_LIMIT>
+class JsonStreamWriter
+    : private StreamWriterBuffer<TDestination>,
+      private JsonSerializer<
+          typename StreamWriterBuffer<TDestination>::writer_type> {
+  typedef StreamWriterBuffer<TDestination> buffer;
+  typedef JsonSerializer<typename buffer::writer_type> base;
+
+ public:
+  explicit JsonStreamWriter(TDestination& destination)
+      : buffer(destination), base(buffer::bufferWriter()) {}
+
+  bool beginObject() {
+    return beginContainer('{', true);
+  }
+
+  bool endObject() {
+    return endContainer('}', true);
+  }
+
+  bool beginArray() {
+    return beginContainer('[', false);
+  }
+
+  bool endArray() {
+    return endContainer(']', false);
+  }
+
+  template <typename TString>
+  bool key(const TString& key) {
+    return writeKey(adaptString(key));
+  }
+
+  template <typename TChar>
+  bool key(TChar* key) {
+    return writeKey(adaptString(key));
+  }
+
+  template <typename T>
+  bool value(const T& value) {
+    if (!beginValue())
+      return false;
+    writeValue(serializer(), value);
+    endValue();
+    return true;
+  }
+
+  template <typename TChar>
+  bool value(TChar* value) {
+    if (!beginValue())
+      return false;
+    writeValue(serializer(), value);
+    endValue();
+    return true;
+  }
+
+  // Tells whether the root value has been entirely written
+  bool complete() const {
+    return _state.complete();
+  }
+
+  // Tells whether a call was rejected
+  bool failed() const {
+    return _state.failed();
+  }
+
+  size_t bytesWritten() const {
+    return base::bytesWritten();
+  }
+
+  // Sends the buffered bytes to the destination.
+  // This is automatic when the root value is complete, and on destruction.
+  void flush() {
+    buffer::flushBuffer();
+  }
+
+ private:
+  base& serializer() {
+    return *this;
+  }
+
+  bool beginValue() {
+    if (!_state.beginValue())
+      return false;
+    if (!_state.inObject() && _state.count() > 0)
+      base::write(',');
+    return true;
+  }
+
+  bool beginContainer(char c, bool isObject) {
+    if (!beginValue() || !_state.push(isObject))
+      return false;
+    base::write(c);
+    return true;
+  }
+
+  bool endContainer(char c, bool isObject) {
+    if (!_state.canPop(isObject))
+      return false;
+    base::write(c);
+    _state.pop();
+    if (_state.complete())
+      flush();
+    return true;
+  }
+
+  void endValue() {
+    _state.endValue();
+    if (_state.complete())
+      flush();
+  }
+
+  template <typename TAdaptedString>
+  bool writeKey(TAdaptedString key) {
+    if (key.isNull() || !_state.beginKey())
+      return false;
+    if (_state.count() > 0)
+      base::write(',');
+    base::visitString(key.data(), key.size());
+    base::write(':');
+    _state.endKey();
+    return true;
+  }
+
+  StreamWriterState<maxDepth> _state;
+};
+
+}  // namespace ARDUINOJSON_NAMESPACE
@@ -46,7 +46,7 @@ class PrettyJsonSerializer : public JsonSerializer<TWriter> {
       _nesting++;
       while (slot != 0) {
         indent();
-        base::visitString(slot->key());
+        base::visitString(slot->key(), slot->keySize());
         base::write(": ");
         slot->data()->resolve()->accept(*this);
 
@@ -0,0 +1,45 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Namespace.hpp>
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// The iterator of JsonArrayStream and JsonObjectStream.
+// Incrementing the iterator calls next(); it becomes equal to end() when
+// next() returns false.
+template <typename TStream, typename TValue>
+class StreamIterator {
+ public:
+  explicit StreamIterator(TStream *stream) : _stream(stream) {}
+
+  TValue &operator*() const {
+    return _stream->current();
+  }
+
+  TValue *operator->() const {
+    return &_stream->current();
+  }
+
+  StreamIterator &operator++() {
+    if (!_stream->next())
+      _stream = 0;
+    return *this;
+  }
+
+  bool operator==(const StreamIterator &other) const {
+    return _stream == other._stream;
+  }
+
+  bool operator!=(const StreamIterator &other) const {
+    return _stream != other._stream;
+  }
+
+ private:
+  TStream *_stream;
+};
+
+}  // namespace ARDUINOJSON_NAMESPACE
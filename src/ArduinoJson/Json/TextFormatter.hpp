@@ -41,13 +41,31 @@ class TextFormatter {
     writeRaw('\"');
   }
 
+  // Since the size is known, the characters that don't need to be escaped
+  // are written in bulk
   void writeString(const char *value, size_t n) {
     ARDUINOJSON_ASSERT(value != NULL);
     writeRaw('\"');
-    while (n--) writeChar(*value++);
+    const char *end = value + n;
+    const char *run = value;
+    for (const char *p = value; p < end; p++) {
+      if (isPlainChar(*p))
+        continue;
+      if (p > run)
+        writeRaw(run, p);
+      writeChar(*p);
+      run = p + 1;
+    }
+    if (end > run)
+      writeRaw(run, end);
     writeRaw('\"');
   }
 
+  // Tells whether writeChar() would write the character as is
+  static bool isPlainChar(char c) {
+    return static_cast<unsigned char>(c) >= 0x20 && c != '\"' && c != '\\';
+  }
+
   void writeChar(char c) {
     char specialChar = EscapeSequence::escapeChar(c);
     if (specialChar) {
@@ -60,6 +78,42 @@ class TextFormatter {
     }
   }
 
+  // Writes bytes as a JSON string (see ARDUINOJSON_ENCODE_BINARY_AS_BASE64)
+  void writeBinary(const uint8_t *data, size_t n) {
+    writeRaw('\"');
+    writeBinaryChars(data, n);
+    writeRaw('\"');
+  }
+
+  // Same as writeBinary() without the quotes, so the bytes can be written in
+  // several chunks. With base64, all chunks but the last must be a multiple
+  // of 3 bytes long.
+  void writeBinaryChars(const uint8_t *data, size_t n) {
+#if ARDUINOJSON_ENCODE_BINARY_AS_BASE64
+    for (; n >= 3; n -= 3, data += 3) {
+      writeRaw(base64Char(data[0] >> 2));
+      writeRaw(base64Char(((data[0] & 0x03) << 4) | (data[1] >> 4)));
+      writeRaw(base64Char(((data[1] & 0x0F) << 2) | (data[2] >> 6)));
+      writeRaw(base64Char(data[2] & 0x3F));
+    }
+    if (n == 1) {
+      writeRaw(base64Char(data[0] >> 2));
+      writeRaw(base64Char((data[0] & 0x03) << 4));
+      writeRaw("==");
+    } else if (n == 2) {
+      writeRaw(base64Char(data[0] >> 2));
+      writeRaw(base64Char(((data[0] & 0x03) << 4) | (data[1] >> 4)));
+      writeRaw(base64Char((data[1] & 0x0F) << 2));
+      writeRaw('=');
+    }
+#else
+    for (; n; n--, data++) {
+      writeRaw(hexChar(*data >> 4));
+      writeRaw(hexChar(*data & 0x0F));
+    }
+#endif
+  }
+
   template <typename T>
   void writeFloat(T value) {
     if (isnan(value))
@@ -158,6 +212,7 @@ class TextFormatter {
   void writeRaw(const char (&s)[N]) {
     _writer.write(reinterpret_cast<const uint8_t *>(s), N - 1);
   }
+
   void writeRaw(char c) {
     _writer.write(static_cast<uint8_t>(c));
   }
@@ -167,5 +222,19 @@ class TextFormatter {
 
  private:
   TextFormatter &operator=(const TextFormatter &);  // cannot be assigned
+
+  static char base64Char(int i) {
+    if (i < 26)
+      return char('A' + i);
+    if (i < 52)
+      return char('a' + i - 26);
+    if (i < 62)
+      return char('0' + i - 52);
+    return i == 62 ? '+' : '/';
+  }
+
+  static char hexChar(int i) {
+    return char(i < 10 ? '0' + i : 'a' + i - 10);
+  }
 };
 }  // namespace ARDUINOJSON_NAMESPACE
@@ -7,6 +7,7 @@
 #include <ArduinoJson/Memory/Alignment.hpp>
 #include <ArduinoJson/Polyfills/assert.hpp>
 #include <ArduinoJson/Polyfills/mpl/max.hpp>
+#include <ArduinoJson/Strings/JsonKeyDictionary.hpp>
 #include <ArduinoJson/Strings/StringAdapters.hpp>
 #include <ArduinoJson/Variant/VariantSlot.hpp>
 
@@ -31,7 +32,8 @@ class MemoryPool {
         _left(buf),
         _right(buf ? buf + capa : 0),
         _end(buf ? buf + capa : 0),
-        _overflowed(false) {
+        _overflowed(false),
+        _keyDictionary(0) {
     ARDUINOJSON_ASSERT(isAligned(_begin));
     ARDUINOJSON_ASSERT(isAligned(_right));
     ARDUINOJSON_ASSERT(isAligned(_end));
@@ -55,6 +57,15 @@ class MemoryPool {
     return _overflowed;
   }
 
+  // The keys that the deserializers don't need to copy
+  const JsonKeyDictionary* keyDictionary() const {
+    return _keyDictionary;
+  }
+
+  void setKeyDictionary(const JsonKeyDictionary* dictionary) {
+    _keyDictionary = dictionary;
+  }
+
   VariantSlot* allocVariant() {
     return allocRight<VariantSlot>();
   }
@@ -85,6 +96,26 @@ class MemoryPool {
     *zoneSize = size_t(_right - _left);
   }
 
+  void getStringZone(const char** zoneStart, size_t* zoneSize) const {
+    *zoneStart = _begin;
+    *zoneSize = size_t(_left - _begin);
+  }
+
+  void getVariantZone(const char** zoneStart, size_t* zoneSize) const {
+    *zoneStart = _right;
+    *zoneSize = size_t(_end - _right);
+  }
+
+  // Reserves n bytes in the string zone, without adding a terminator
+  char* allocStringZone(size_t n) {
+    return allocString(n);
+  }
+
+  // Reserves n contiguous slots in the variant zone
+  VariantSlot* allocVariants(size_t n) {
+    return reinterpret_cast<VariantSlot*>(allocRight(n * sizeof(VariantSlot)));
+  }
+
   const char* saveStringFromFreeZone(size_t len) {
 #if ARDUINOJSON_ENABLE_STRING_DEDUPLICATION
     const char* dup = findString(adaptString(_left, len));
@@ -113,7 +144,7 @@ class MemoryPool {
     return _left + bytes <= _right;
   }
 
-  bool owns(void* p) const {
+  bool owns(const void* p) const {
     return _begin <= p && p < _end;
   }
 
@@ -206,6 +237,7 @@ class MemoryPool {
 
   char *_begin, *_left, *_right, *_end;
   bool _overflowed;
+  const JsonKeyDictionary* _keyDictionary;
 };
 
 }  // namespace ARDUINOJSON_NAMESPACE
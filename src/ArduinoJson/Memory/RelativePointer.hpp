@@ -0,0 +1,37 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Namespace.hpp>
+
+#include <stddef.h>  // ptrdiff_t
+#include <stdint.h>  // uintptr_t
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// A relative pointer stores the distance between the target and the object
+// that holds the reference, so a block containing both can be moved (realloc,
+// memcpy, mmap...) without patching the reference.
+// A null pointer is stored as 0.
+
+template <typename T>
+inline ptrdiff_t makeRelative(const void* base, const T* target) {
+  if (!target)
+    return 0;
+  return reinterpret_cast<const char*>(target) -
+         reinterpret_cast<const char*>(base);
+}
+
+template <typename T>
+inline T* resolveRelative(const void* base, ptrdiff_t offset) {
+  if (!offset)
+    return 0;
+  // The sum is computed on integers, so that a corrupted offset can't overflow
+  // a pointer, see validateImage()
+  uintptr_t target = reinterpret_cast<uintptr_t>(base) + uintptr_t(offset);
+  return reinterpret_cast<T*>(target);
+}
+
+}  // namespace ARDUINOJSON_NAMESPACE
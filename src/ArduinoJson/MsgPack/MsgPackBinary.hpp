@@ -0,0 +1,210 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Variant/VariantFunctions.hpp>
+#include <ArduinoJson/Variant/VariantRef.hpp>
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// A MessagePack bin value.
+// Only refers to the bytes, the variant makes a copy when assigned.
+class MsgPackBinary {
+ public:
+  MsgPackBinary() : _data(0), _size(0) {}
+  MsgPackBinary(const void* data, size_t size)
+      : _data(reinterpret_cast<const uint8_t*>(data)), _size(size) {}
+
+  const uint8_t* data() const {
+    return _data;
+  }
+
+  size_t size() const {
+    return _size;
+  }
+
+ private:
+  const uint8_t* _data;
+  size_t _size;
+};
+
+// A MessagePack ext value: an application-defined type code and some bytes.
+// Only refers to the bytes, the variant makes a copy when assigned.
+class MsgPackExtension {
+ public:
+  MsgPackExtension() : _type(0), _data(0), _size(0) {}
+  MsgPackExtension(int8_t type, const void* data, size_t size)
+      : _type(type),
+        _data(reinterpret_cast<const uint8_t*>(data)),
+        _size(size) {}
+
+  int8_t type() const {
+    return _type;
+  }
+
+  const uint8_t* data() const {
+    return _data;
+  }
+
+  size_t size() const {
+    return _size;
+  }
+
+ private:
+  int8_t _type;
+  const uint8_t* _data;
+  size_t _size;
+};
+
+// The timestamp extension predefined by MessagePack (type -1)
+class MsgPackTimestamp {
+ public:
+  static const int8_t extensionType = -1;
+
+  MsgPackTimestamp() : _seconds(0), _nanoseconds(0) {}
+  MsgPackTimestamp(int64_t seconds, uint32_t nanoseconds = 0)
+      : _seconds(seconds), _nanoseconds(nanoseconds) {}
+
+  // Seconds since 1970-01-01 00:00:00 UTC
+  int64_t seconds() const {
+    return _seconds;
+  }
+
+  uint32_t nanoseconds() const {
+    return _nanoseconds;
+  }
+
+ private:
+  int64_t _seconds;
+  uint32_t _nanoseconds;
+};
+
+template <typename TVisitor>
+inline void writeValue(TVisitor& visitor, MsgPackBinary value) {
+  visitor.visitBinary(value.data(), value.size());
+}
+
+template <typename TVisitor>
+inline void writeValue(TVisitor& visitor, MsgPackExtension value) {
+  visitor.visitExtension(value.type(), value.data(), value.size());
+}
+
+template <>
+struct Converter<MsgPackBinary> {
+  static void toJson(MsgPackBinary src, VariantRef dst) {
+    VariantData* data = getData(dst);
+    if (data)
+      data->storeBinary(src.data(), src.size(), getPool(dst));
+  }
+
+  static MsgPackBinary fromJson(VariantConstRef src) {
+    const VariantData* data = getData(src);
+    if (!data || !data->resolve()->isBinary())
+      return MsgPackBinary();
+    String bytes = data->resolve()->asBinary();
+    return MsgPackBinary(bytes.c_str(), bytes.size());
+  }
+
+  static bool checkJson(VariantConstRef src) {
+    const VariantData* data = getData(src);
+    return data && data->resolve()->isBinary();
+  }
+};
+
+template <>
+struct Converter<MsgPackExtension> {
+  static void toJson(MsgPackExtension src, VariantRef dst) {
+    VariantData* data = getData(dst);
+    if (data)
+      data->storeExtension(src.type(), src.data(), src.size(), getPool(dst));
+  }
+
+  static MsgPackExtension fromJson(VariantConstRef src) {
+    const VariantData* data = getData(src);
+    if (!data || !data->resolve()->isExtension())
+      return MsgPackExtension();
+    // the first byte is the type code
+    String bytes = data->resolve()->asBinary();
+    return MsgPackExtension(static_cast<int8_t>(bytes.c_str()[0]),
+                            bytes.c_str() + 1, bytes.size() - 1);
+  }
+
+  static bool checkJson(VariantConstRef src) {
+    const VariantData* data = getData(src);
+    return data && data->resolve()->isExtension();
+  }
+};
+
+template <>
+struct Converter<MsgPackTimestamp> {
+  static void toJson(MsgPackTimestamp src, VariantRef dst) {
+    uint8_t buffer[12];
+    size_t size;
+    uint64_t seconds = static_cast<uint64_t>(src.seconds());
+    if (src.seconds() >= 0 && seconds >> 34 == 0) {
+      uint64_t value = uint64_t(src.nanoseconds()) << 34 | seconds;
+      if (value >> 32 == 0) {  // timestamp 32
+        writeBigEndian(buffer, value, 4);
+        size = 4;
+      } else {  // timestamp 64
+        writeBigEndian(buffer, value, 8);
+        size = 8;
+      }
+    } else {  // timestamp 96
+      writeBigEndian(buffer, src.nanoseconds(), 4);
+      writeBigEndian(buffer + 4, seconds, 8);
+      size = 12;
+    }
+    Converter<MsgPackExtension>::toJson(
+        MsgPackExtension(MsgPackTimestamp::extensionType, buffer, size), dst);
+  }
+
+  static MsgPackTimestamp fromJson(VariantConstRef src) {
+    MsgPackExtension ext = Converter<MsgPackExtension>::fromJson(src);
+    if (ext.type() != MsgPackTimestamp::extensionType)
+      return MsgPackTimestamp();
+    switch (ext.size()) {
+      case 4:
+        return MsgPackTimestamp(
+            static_cast<int64_t>(readBigEndian(ext.data(), 4)));
+      case 8: {
+        uint64_t value = readBigEndian(ext.data(), 8);
+        uint64_t seconds = value & ((uint64_t(1) << 34) - 1);
+        return MsgPackTimestamp(static_cast<int64_t>(seconds),
+                                static_cast<uint32_t>(value >> 34));
+      }
+      case 12:
+        return MsgPackTimestamp(
+            static_cast<int64_t>(readBigEndian(ext.data() + 4, 8)),
+            static_cast<uint32_t>(readBigEndian(ext.data(), 4)));
+      default:
+        return MsgPackTimestamp();
+    }
+  }
+
+  static bool checkJson(VariantConstRef src) {
+    if (!Converter<MsgPackExtension>::checkJson(src))
+      return false;
+    MsgPackExtension ext = Converter<MsgPackExtension>::fromJson(src);
+    return ext.type() == MsgPackTimestamp::extensionType &&
+           (ext.size() == 4 || ext.size() == 8 || ext.size() == 12);
+  }
+
+ private:
+  static void writeBigEndian(uint8_t* p, uint64_t value, size_t n) {
+    while (n--) {
+      p[n] = static_cast<uint8_t>(value);
+      value >>= 8;
+    }
+  }
+
+  static uint64_t readBigEndian(const uint8_t* p, size_t n) {
+    uint64_t value = 0;
+    while (n--) value = value << 8 | *p++;
+    return value;
+  }
+};
+
+}  // namespace ARDUINOJSON_NAMESPACE
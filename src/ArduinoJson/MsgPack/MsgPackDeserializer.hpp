@@ -31,7 +31,7 @@ class MsgPackDeserializer {
     return _foundSomething ? _error : DeserializationError::EmptyInput;
   }
 
- private:
+ protected:
   bool invalidInput() {
     _error = DeserializationError::InvalidInput;
     return false;
@@ -71,23 +71,41 @@ class MsgPackDeserializer {
           variant->setBoolean(true);
         return true;
 
-      case 0xc4:  // bin 8 (not supported)
-        return skipString<uint8_t>();
+      case 0xc4:  // bin 8
+        if (allowValue)
+          return readBinary<uint8_t>(variant);
+        else
+          return skipString<uint8_t>();
 
-      case 0xc5:  // bin 16 (not supported)
-        return skipString<uint16_t>();
+      case 0xc5:  // bin 16
+        if (allowValue)
+          return readBinary<uint16_t>(variant);
+        else
+          return skipString<uint16_t>();
 
-      case 0xc6:  // bin 32 (not supported)
-        return skipString<uint32_t>();
+      case 0xc6:  // bin 32
+        if (allowValue)
+          return readBinary<uint32_t>(variant);
+        else
+          return skipString<uint32_t>();
 
-      case 0xc7:  // ext 8 (not supported)
-        return skipExt<uint8_t>();
+      case 0xc7:  // ext 8
+        if (allowValue)
+          return readExtension<uint8_t>(variant);
+        else
+          return skipExt<uint8_t>();
 
-      case 0xc8:  // ext 16 (not supported)
-        return skipExt<uint16_t>();
+      case 0xc8:  // ext 16
+        if (allowValue)
+          return readExtension<uint16_t>(variant);
+        else
+          return skipExt<uint16_t>();
 
-      case 0xc9:  // ext 32 (not supported)
-        return skipExt<uint32_t>();
+      case 0xc9:  // ext 32
+        if (allowValue)
+          return readExtension<uint32_t>(variant);
+        else
+          return skipExt<uint32_t>();
 
       case 0xca:
         if (allowValue)
@@ -157,20 +175,35 @@ class MsgPackDeserializer {
         return skipBytes(8);
 #endif
 
-      case 0xd4:  // fixext 1 (not supported)
-        return skipBytes(2);
+      case 0xd4:  // fixext 1
+        if (allowValue)
+          return readExtension(variant, 1);
+        else
+          return skipBytes(2);
 
-      case 0xd5:  // fixext 2 (not supported)
-        return skipBytes(3);
+      case 0xd5:  // fixext 2
+        if (allowValue)
+          return readExtension(variant, 2);
+        else
+          return skipBytes(3);
 
-      case 0xd6:  // fixext 4 (not supported)
-        return skipBytes(5);
+      case 0xd6:  // fixext 4
+        if (allowValue)
+          return readExtension(variant, 4);
+        else
+          return skipBytes(5);
 
-      case 0xd7:  // fixext 8 (not supported)
-        return skipBytes(9);
+      case 0xd7:  // fixext 8
+        if (allowValue)
+          return readExtension(variant, 8);
+        else
+          return skipBytes(9);
 
-      case 0xd8:  // fixext 16 (not supported)
-        return skipBytes(17);
+      case 0xd8:  // fixext 16
+        if (allowValue)
+          return readExtension(variant, 16);
+        else
+          return skipBytes(17);
 
       case 0xd9:
         if (allowValue)
@@ -247,13 +280,10 @@ class MsgPackDeserializer {
   }
 
   bool skipBytes(size_t n) {
-    for (; n; --n) {
-      if (_reader.read() < 0) {
-        _error = DeserializationError::IncompleteInput;
-        return false;
-      }
-    }
-    return true;
+    if (_reader.skip(n) == n)
+      return true;
+    _error = DeserializationError::IncompleteInput;
+    return false;
   }
 
   template <typename T>
@@ -325,6 +355,38 @@ class MsgPackDeserializer {
     return readString(size);
   }
 
+  template <typename T>
+  bool readBinary(VariantData *variant) {
+    T size;
+    if (!readInteger(size))
+      return false;
+    if (!readString(size))
+      return false;
+    variant->setBinary(_stringStorage.save());
+    return true;
+  }
+
+  template <typename T>
+  bool readExtension(VariantData *variant) {
+    T size;
+    if (!readInteger(size))
+      return false;
+    return readExtension(variant, size);
+  }
+
+  bool readExtension(VariantData *variant, size_t size) {
+    // the type code is stored just before the data
+    size_t n = size + 1;
+    if (n == 0) {  // overflow
+      _error = DeserializationError::NoMemory;
+      return false;
+    }
+    if (!readString(n))
+      return false;
+    variant->setExtension(_stringStorage.save());
+    return true;
+  }
+
   template <typename T>
   bool skipString() {
     T size;
@@ -342,18 +404,15 @@ class MsgPackDeserializer {
 
   bool readString(size_t n) {
     _stringStorage.startString();
-    for (; n; --n) {
-      uint8_t c;
-      if (!readBytes(c))
+    char *p = _stringStorage.reserve(n);
+    if (!p) {
+      // consume the input anyway, to report IncompleteInput if relevant
+      if (!skipBytes(n))
         return false;
-      _stringStorage.append(static_cast<char>(c));
-    }
-    if (!_stringStorage.isValid()) {
       _error = DeserializationError::NoMemory;
       return false;
     }
-
-    return true;
+    return readBytes(reinterpret_cast<uint8_t *>(p), n);
   }
 
   template <typename TSize, typename TFilter>
@@ -429,9 +488,9 @@ class MsgPackDeserializer {
       if (memberFilter.allow()) {
         ARDUINOJSON_ASSERT(object);
 
-        // Save key in memory pool.
+        // Save key in memory pool, unless it's in the key dictionary.
         // This MUST be done before adding the slot.
-        key = _stringStorage.save();
+        key = _stringStorage.saveKey();
 
         VariantSlot *slot = object->addSlot(_pool);
         if (!slot) {
@@ -45,16 +45,7 @@ class MsgPackSerializer : public Visitor<size_t> {
   }
 
   size_t visitArray(const CollectionData& array) {
-    size_t n = array.size();
-    if (n < 0x10) {
-      writeByte(uint8_t(0x90 + array.size()));
-    } else if (n < 0x10000) {
-      writeByte(0xDC);
-      writeInteger(uint16_t(n));
-    } else {
-      writeByte(0xDD);
-      writeInteger(uint32_t(n));
-    }
+    writeArrayHeader(array.size());
     for (const VariantSlot* slot = array.head(); slot; slot = slot->next()) {
       slot->data()->resolve()->accept(*this);
     }
@@ -62,18 +53,9 @@ class MsgPackSerializer : public Visitor<size_t> {
   }
 
   size_t visitObject(const CollectionData& object) {
-    size_t n = object.size();
-    if (n < 0x10) {
-      writeByte(uint8_t(0x80 + n));
-    } else if (n < 0x10000) {
-      writeByte(0xDE);
-      writeInteger(uint16_t(n));
-    } else {
-      writeByte(0xDF);
-      writeInteger(uint32_t(n));
-    }
+    writeMapHeader(object.size());
     for (const VariantSlot* slot = object.head(); slot; slot = slot->next()) {
-      visitString(slot->key());
+      visitString(slot->key(), slot->keySize());
       slot->data()->resolve()->accept(*this);
     }
     return bytesWritten();
@@ -86,19 +68,57 @@ class MsgPackSerializer : public Visitor<size_t> {
   size_t visitString(const char* value, size_t n) {
     ARDUINOJSON_ASSERT(value != NULL);
 
-    if (n < 0x20) {
-      writeByte(uint8_t(0xA0 + n));
-    } else if (n < 0x100) {
-      writeByte(0xD9);
+    writeStringHeader(n);
+    writeBytes(reinterpret_cast<const uint8_t*>(value), n);
+    return bytesWritten();
+  }
+
+  size_t visitBinary(const uint8_t* data, size_t n) {
+    if (n < 0x100) {
+      writeByte(0xC4);
       writeInteger(uint8_t(n));
     } else if (n < 0x10000) {
-      writeByte(0xDA);
+      writeByte(0xC5);
       writeInteger(uint16_t(n));
     } else {
-      writeByte(0xDB);
+      writeByte(0xC6);
       writeInteger(uint32_t(n));
     }
-    writeBytes(reinterpret_cast<const uint8_t*>(value), n);
+    writeBytes(data, n);
+    return bytesWritten();
+  }
+
+  size_t visitExtension(int8_t type, const uint8_t* data, size_t n) {
+    switch (n) {
+      case 1:
+        writeByte(0xD4);
+        break;
+      case 2:
+        writeByte(0xD5);
+        break;
+      case 4:
+        writeByte(0xD6);
+        break;
+      case 8:
+        writeByte(0xD7);
+        break;
+      case 16:
+        writeByte(0xD8);
+        break;
+      default:
+        if (n < 0x100) {
+          writeByte(0xC7);
+          writeInteger(uint8_t(n));
+        } else if (n < 0x10000) {
+          writeByte(0xC8);
+          writeInteger(uint16_t(n));
+        } else {
+          writeByte(0xC9);
+          writeInteger(uint32_t(n));
+        }
+    }
+    writeInteger(type);
+    writeBytes(data, n);
     return bytesWritten();
   }
 
@@ -175,11 +195,54 @@ class MsgPackSerializer : public Visitor<size_t> {
     return bytesWritten();
   }
 
- private:
+  size_t writeArrayHeader(size_t n) {
+    if (n < 0x10) {
+      writeByte(uint8_t(0x90 + n));
+    } else if (n < 0x10000) {
+      writeByte(0xDC);
+      writeInteger(uint16_t(n));
+    } else {
+      writeByte(0xDD);
+      writeInteger(uint32_t(n));
+    }
+    return bytesWritten();
+  }
+
+  size_t writeMapHeader(size_t n) {
+    if (n < 0x10) {
+      writeByte(uint8_t(0x80 + n));
+    } else if (n < 0x10000) {
+      writeByte(0xDE);
+      writeInteger(uint16_t(n));
+    } else {
+      writeByte(0xDF);
+      writeInteger(uint32_t(n));
+    }
+    return bytesWritten();
+  }
+
+  size_t writeStringHeader(size_t n) {
+    if (n < 0x20) {
+      writeByte(uint8_t(0xA0 + n));
+    } else if (n < 0x100) {
+      writeByte(0xD9);
+      writeInteger(uint8_t(n));
+    } else if (n < 0x10000) {
+      writeByte(0xDA);
+      writeInteger(uint16_t(n));
+    } else {
+      writeByte(0xDB);
+      writeInteger(uint32_t(n));
+    }
+    return bytesWritten();
+  }
+
+ protected:
   size_t bytesWritten() const {
     return _writer.count();
   }
 
+ private:
   void writeByte(uint8_t c) {
     _writer.write(c);
   }
@@ -0,0 +1,144 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/MsgPack/MsgPackSerializer.hpp>
+#include <ArduinoJson/Serialization/StreamWriterBuffer.hpp>
+#include <ArduinoJson/Serialization/StreamWriterState.hpp>
+#include <ArduinoJson/Serialization/writeValue.hpp>
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// Writes MessagePack directly to the destination, without building a
+// JsonDocument. Same as JsonStreamWriter, except that MessagePack needs the
+// size of arrays and maps upfront:
+//
+//   MsgPackStreamWriter<std::ostream> writer(std::cout);
+//   writer.beginObject(1);
+//   writer.key("values");
+//   writer.beginArray(2);
+//   writer.value(1);
+//   writer.value(2);
+//   writer.endArray();
+//   writer.endObject();
+//
+// The end functions write nothing, but they verify that the container has
+// the announced number of items.
+template <typename TDestination,
+          size_t maxDepth = ARDUINOJSON_DEFAULT_NESTING_LIMIT>
+class MsgPackStreamWriter
+    : private StreamWriterBuffer<TDestination>,
+      private MsgPackSerializer<
+          typename StreamWriterBuffer<TDestination>::writer_type> {
+  typedef StreamWriterBuffer<TDestination> buffer;
+  typedef MsgPackSerializer<typename buffer::writer_type> base;
+
+ public:
+  explicit MsgPackStreamWriter(TDestination& destination)
+      : buffer(destination), base(buffer::bufferWriter()) {}
+
+  bool beginObject(size_t size) {
+    if (!_state.beginValue() || !_state.push(true, size))
+      return false;
+    base::writeMapHeader(size);
+    return true;
+  }
+
+  bool endObject() {
+    return endContainer(true);
+  }
+
+  bool beginArray(size_t size) {
+    if (!_state.beginValue() || !_state.push(false, size))
+      return false;
+    base::writeArrayHeader(size);
+    return true;
+  }
+
+  bool endArray() {
+    return endContainer(false);
+  }
+
+  template <typename TString>
+  bool key(const TString& key) {
+    return writeKey(adaptString(key));
+  }
+
+  template <typename TChar>
+  bool key(TChar* key) {
+    return writeKey(adaptString(key));
+  }
+
+  template <typename T>
+  bool value(const T& value) {
+    if (!_state.beginValue())
+      return false;
+    writeValue(serializer(), value);
+    endValue();
+    return true;
+  }
+
+  template <typename TChar>
+  bool value(TChar* value) {
+    if (!_state.beginValue())
+      return false;
+    writeValue(serializer(), value);
+    endValue();
+    return true;
+  }
+
+  // Tells whether the root value has been entirely written
+  bool complete() const {
+    return _state.complete();
+  }
+
+  // Tells whether a call was rejected
+  bool failed() const {
+    return _state.failed();
+  }
+
+  size_t bytesWritten() const {
+    return base::bytesWritten();
+  }
+
+  // Sends the buffered bytes to the destination.
+  // This is automatic when the root value is complete, and on destruction.
+  void flush() {
+    buffer::flushBuffer();
+  }
+
+ private:
+  base& serializer() {
+    return *this;
+  }
+
+  bool endContainer(bool isObject) {
+    if (!_state.canPop(isObject))
+      return false;
+    _state.pop();
+    if (_state.complete())
+      flush();
+    return true;
+  }
+
+  void endValue() {
+    _state.endValue();
+    if (_state.complete())
+      flush();
+  }
+
+  template <typename TAdaptedString>
+  bool writeKey(TAdaptedString key) {
+    if (key.isNull() || !_state.beginKey())
+      return false;
+    base::visitString(key.data(), key.size());
+    _state.endKey();
+    return true;
+  }
+
+  StreamWriterState<maxDepth> _state;
+};
+
+}  // namespace ARDUINOJSON_NAMESPACE
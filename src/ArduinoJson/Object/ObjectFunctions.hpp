@@ -25,6 +25,14 @@ inline VariantData *objectGetMember(const CollectionData *obj,
   return obj->getMember(key);
 }
 
+template <typename TAdaptedString>
+inline VariantData *objectGetMember(const CollectionData *obj,
+                                    TAdaptedString key, VariantSlot *&cursor) {
+  if (!obj)
+    return 0;
+  return obj->getMember(key, cursor);
+}
+
 template <typename TAdaptedString>
 void objectRemove(CollectionData *obj, TAdaptedString key) {
   if (!obj)
@@ -42,6 +42,10 @@ class ObjectRefBase {
     return variantNesting(getVariantData());
   }
 
+  FORCE_INLINE uint32_t hash() const {
+    return variantHash(getVariantData());
+  }
+
   FORCE_INLINE size_t size() const {
     return _data ? _data->size() : 0;
   }
@@ -108,6 +112,36 @@ class ObjectConstRef : public ObjectRefBase<const CollectionData>,
     return VariantConstRef(objectGetMember(_data, adaptString(key)));
   }
 
+  // Looks up several members at once, and returns the number of members
+  // found; the missing ones are unbound.
+  // The search for each key starts after the member of the previous key, and
+  // wraps around. When every key is present, and the keys are in the same
+  // order as the members, the object is walked only once: O(n + k) instead of
+  // O(n * k). A missing key still costs a walk of the whole object.
+  //
+  //   const char* const keys[] = {"id", "ts", "value"};
+  //   JsonVariantConst values[3];
+  //   obj.getMembers(keys, values);
+  template <typename TString, size_t N>
+  FORCE_INLINE size_t getMembers(const TString (&keys)[N],
+                                 VariantConstRef (&values)[N]) const {
+    return getMembers(keys, values, N);
+  }
+
+  template <typename TString>
+  size_t getMembers(const TString* keys, VariantConstRef* values,
+                    size_t n) const {
+    VariantSlot* cursor = 0;
+    size_t found = 0;
+    for (size_t i = 0; i < n; i++) {
+      values[i] =
+          VariantConstRef(objectGetMember(_data, adaptString(keys[i]), cursor));
+      if (!values[i].isUnbound())
+        found++;
+    }
+    return found;
+  }
+
   // operator[](const std::string&) const
   // operator[](const String&) const
   template <typename TString>
@@ -134,13 +168,23 @@ class ObjectConstRef : public ObjectRefBase<const CollectionData>,
     if (!_data || !rhs._data)
       return false;
 
-    size_t count = 0;
+    if (size() != rhs.size())
+      return false;
+
+    // Each lookup starts after the previous match, so when the members are in
+    // the same order, the objects are compared in lockstep, and the stored
+    // key hashes reject the other members without comparing strings.
+    // This doesn't compare the structural hashes, because computing them
+    // costs as much as the comparison itself; compare cached hash() values
+    // before calling this.
+    VariantSlot* cursor = 0;
     for (iterator it = begin(); it != end(); ++it) {
-      if (it->value() != rhs[it->key()])
+      VariantConstRef value(
+          objectGetMember(rhs._data, adaptString(it->key()), cursor));
+      if (it->value() != value)
         return false;
-      count++;
     }
-    return count == rhs.size();
+    return true;
   }
 
  private:
@@ -220,6 +264,26 @@ class ObjectRef : public ObjectRefBase<CollectionData>,
     return VariantConstRef(objectGetMember(_data, adaptString(key)));
   }
 
+  // Same as ObjectConstRef::getMembers(), but the values are writable
+  template <typename TString, size_t N>
+  FORCE_INLINE size_t getMembers(const TString (&keys)[N],
+                                 VariantRef (&values)[N]) const {
+    return getMembers(keys, values, N);
+  }
+
+  template <typename TString>
+  size_t getMembers(const TString* keys, VariantRef* values, size_t n) const {
+    VariantSlot* cursor = 0;
+    size_t found = 0;
+    for (size_t i = 0; i < n; i++) {
+      values[i] = VariantRef(
+          _pool, objectGetMember(_data, adaptString(keys[i]), cursor));
+      if (!values[i].isUnbound())
+        found++;
+    }
+    return found;
+  }
+
   // getOrAddMember(const std::string&) const
   // getOrAddMember(const String&) const
   template <typename TString>
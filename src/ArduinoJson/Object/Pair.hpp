@@ -13,8 +13,7 @@ class Pair {
  public:
   Pair(MemoryPool* pool, VariantSlot* slot) {
     if (slot) {
-      _key = String(slot->key(),
-                    slot->ownsKey() ? String::Copied : String::Linked);
+      _key = slot->keyString();
       _value = VariantRef(pool, slot->data());
     }
   }
@@ -36,8 +35,7 @@ class PairConst {
  public:
   PairConst(const VariantSlot* slot) {
     if (slot) {
-      _key = String(slot->key(),
-                    slot->ownsKey() ? String::Copied : String::Linked);
+      _key = slot->keyString();
       _value = VariantConstRef(slot->data());
     }
   }
@@ -0,0 +1,147 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Polyfills/assert.hpp>
+#include <ArduinoJson/Strings/String.hpp>
+#include <ArduinoJson/Variant/VariantData.hpp>
+
+#include <stddef.h>  // size_t
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// A reference token of a JSON Pointer (RFC 6901), adapted like a string, so it
+// can be looked up without decoding it first: "~1" and "~0" are decoded on the
+// fly.
+class JsonPointerToken {
+ public:
+  static const size_t typeSortKey = 2;
+
+  JsonPointerToken() : _str(0), _rawSize(0), _size(0) {}
+
+  JsonPointerToken(const char* str, size_t rawSize)
+      : _str(str), _rawSize(rawSize), _size(rawSize) {
+    for (size_t i = 0; i < rawSize; i++) {
+      if (str[i] == '~')
+        _size--;
+    }
+  }
+
+  bool isNull() const {
+    return !_str;
+  }
+
+  size_t size() const {
+    return _size;
+  }
+
+  char operator[](size_t i) const {
+    ARDUINOJSON_ASSERT(_str != 0);
+    ARDUINOJSON_ASSERT(i <= size());
+    if (_size == _rawSize)
+      return _str[i];
+    const char* p = _str;
+    while (i--) p += *p == '~' ? 2 : 1;
+    if (*p != '~')
+      return *p;
+    return p[1] == '1' ? '/' : '~';
+  }
+
+  // Tells whether each '~' is followed by '0' or '1'
+  bool isValid() const {
+    for (size_t i = 0; i < _rawSize; i++) {
+      if (_str[i] == '~' && (i + 1 == _rawSize ||
+                             (_str[i + 1] != '0' && _str[i + 1] != '1')))
+        return false;
+    }
+    return true;
+  }
+
+  // "-" designates the (nonexistent) element after the last one
+  bool isEnd() const {
+    return _rawSize == 1 && _str[0] == '-';
+  }
+
+  // Parses an array index: decimal digits, without leading zeros
+  bool toIndex(size_t& index) const {
+    if (_rawSize == 0 || (_rawSize > 1 && _str[0] == '0'))
+      return false;
+    index = 0;
+    for (size_t i = 0; i < _rawSize; i++) {
+      char c = _str[i];
+      if (c < '0' || c > '9')
+        return false;
+      size_t next = index * 10 + size_t(c - '0');
+      if (next / 10 != index)  // overflow
+        return false;
+      index = next;
+    }
+    return true;
+  }
+
+ private:
+  const char* _str;
+  size_t _rawSize;
+  size_t _size;
+};
+
+// Splits a JSON Pointer into reference tokens
+class JsonPointerReader {
+ public:
+  JsonPointerReader(String pointer)
+      : _ptr(pointer.c_str()), _end(pointer.c_str() + pointer.size()) {}
+
+  // A pointer is either empty (the whole document), or starts with a '/'
+  bool isValid() const {
+    return _ptr && (_ptr == _end || *_ptr == '/');
+  }
+
+  bool atEnd() const {
+    return _ptr == _end;
+  }
+
+  JsonPointerToken next() {
+    ARDUINOJSON_ASSERT(!atEnd());
+    const char* begin = ++_ptr;  // skip '/'
+    while (_ptr != _end && *_ptr != '/') _ptr++;
+    return JsonPointerToken(begin, size_t(_ptr - begin));
+  }
+
+ private:
+  const char* _ptr;
+  const char* _end;
+};
+
+// Returns the member or the element designated by the token, or null.
+// Linked variants (see link()) are read-only, so they are not traversed.
+inline VariantData* pointerGetChild(VariantData* var, JsonPointerToken token) {
+  if (!var || !token.isValid())
+    return 0;
+  if (var->isObject())
+    return var->asObject()->getMember(token);
+  size_t index;
+  if (var->isArray() && token.toIndex(index))
+    return var->asArray()->getElement(index);
+  return 0;
+}
+
+inline const VariantData* pointerGetChild(const VariantData* var,
+                                          JsonPointerToken token) {
+  return pointerGetChild(const_cast<VariantData*>(var ? var->resolve() : 0),
+                         token);
+}
+
+// Returns the value designated by the whole pointer, or null
+template <typename TVariantData>
+inline TVariantData* pointerGetValue(TVariantData* root, String pointer) {
+  JsonPointerReader reader(pointer);
+  if (!reader.isValid())
+    return 0;
+  TVariantData* var = root;
+  while (var && !reader.atEnd()) var = pointerGetChild(var, reader.next());
+  return var;
+}
+
+}  // namespace ARDUINOJSON_NAMESPACE
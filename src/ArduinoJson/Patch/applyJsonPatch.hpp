@@ -0,0 +1,199 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Deserialization/DeserializationError.hpp>
+#include <ArduinoJson/Document/JsonDocument.hpp>
+#include <ArduinoJson/Patch/JsonPointer.hpp>
+#include <ArduinoJson/Patch/jsonEquals.hpp>
+
+#include <string.h>  // memcmp
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// Applies the operations of a JSON Patch (RFC 6902) to a document, in place.
+// "replace" overwrites the existing slot, and "move" and "copy" share the
+// strings that are already in the pool.
+class JsonPatcher {
+ public:
+  JsonPatcher(VariantData* root, MemoryPool* pool)
+      : _root(root), _pool(pool) {}
+
+  DeserializationError apply(const VariantData* patch) {
+    const CollectionData* ops = patch ? patch->resolve()->asArray() : 0;
+    if (!ops)
+      return DeserializationError::InvalidInput;
+    for (const VariantSlot* s = ops->head(); s; s = s->next()) {
+      if (!applyOperation(s->data()->resolve()))
+        return _pool->overflowed() ? DeserializationError::NoMemory
+                                   : DeserializationError::InvalidInput;
+    }
+    return DeserializationError::Ok;
+  }
+
+ private:
+  bool applyOperation(const VariantData* op) {
+    String name = getString(op, "op");
+    String path = getString(op, "path");
+    if (!name || !path)
+      return false;
+
+    if (name == String("add"))
+      return add(path, getMember(op, "value"));
+    if (name == String("remove"))
+      return remove(path) != 0;
+    if (name == String("replace"))
+      return replace(path, getMember(op, "value"));
+    if (name == String("move"))
+      return move(getString(op, "from"), path);
+    if (name == String("copy"))
+      return copy(getString(op, "from"), path);
+    if (name == String("test"))
+      return test(path, getMember(op, "value"));
+    return false;
+  }
+
+  bool add(String path, const VariantData* value) {
+    if (!value)
+      return false;
+    VariantData* parent;
+    JsonPointerToken token;
+    if (!locate(path, parent, token))
+      return false;
+    VariantData* target = insert(parent, token);
+    return target && target->copyFrom(*value, _pool);
+  }
+
+  // Returns the removed value, which stays in the pool
+  VariantData* remove(String path) {
+    VariantData* parent;
+    JsonPointerToken token;
+    if (!locate(path, parent, token))
+      return 0;
+    if (!parent) {
+      _root->setNull();
+      return _root;
+    }
+    VariantData* value = pointerGetChild(parent, token);
+    if (!value)
+      return 0;
+    if (parent->isObject()) {
+      parent->remove(token);
+    } else {
+      size_t index = 0;
+      token.toIndex(index);  // can't fail, see pointerGetChild()
+      parent->remove(index);
+    }
+    return value;
+  }
+
+  bool replace(String path, const VariantData* value) {
+    if (!value)
+      return false;
+    VariantData* target = pointerGetValue(_root, path);
+    return target && target->copyFrom(*value, _pool);
+  }
+
+  bool move(String from, String path) {
+    if (!from || isParentOf(from, path))
+      return false;
+    if (from == path)
+      return pointerGetValue(_root, from) != 0;
+    const VariantData* value = remove(from);
+    return value && add(path, value);
+  }
+
+  bool copy(String from, String path) {
+    if (!from)
+      return false;
+    const VariantData* value =
+        pointerGetValue(const_cast<const VariantData*>(_root), from);
+    if (!value)
+      return false;
+    if (isParentOf(from, path)) {
+      // the value is copied in itself, so it needs a snapshot
+      VariantSlot* snapshot = _pool->allocVariant();
+      if (!snapshot)
+        return false;
+      snapshot->clear();
+      if (!snapshot->data()->copyFrom(*value, _pool))
+        return false;
+      value = snapshot->data();
+    }
+    return add(path, value);
+  }
+
+  bool test(String path, const VariantData* value) {
+    const VariantData* target =
+        pointerGetValue(const_cast<const VariantData*>(_root), path);
+    return value && target && jsonEquals(target, value);
+  }
+
+  // Finds the parent of the value designated by the path, and the token that
+  // designates the value in the parent. The parent of the root is null.
+  bool locate(String path, VariantData*& parent, JsonPointerToken& token) {
+    JsonPointerReader reader(path);
+    if (!reader.isValid())
+      return false;
+    parent = 0;
+    if (reader.atEnd())
+      return true;
+    parent = _root;
+    token = reader.next();
+    while (parent && !reader.atEnd()) {
+      parent = pointerGetChild(parent, token);
+      token = reader.next();
+    }
+    return parent && token.isValid();
+  }
+
+  VariantData* insert(VariantData* parent, JsonPointerToken token) {
+    if (!parent)
+      return _root;
+    if (parent->isObject())
+      return parent->asObject()->getOrAddMember(token, _pool,
+                                                CopyStringStoragePolicy());
+    if (!parent->isArray())
+      return 0;
+    CollectionData* array = parent->asArray();
+    if (token.isEnd())
+      return array->addElement(_pool);
+    size_t index;
+    if (!token.toIndex(index) || index > array->size())
+      return 0;
+    return array->insertElement(index, _pool);
+  }
+
+  static bool isParentOf(String parent, String child) {
+    return parent.size() < child.size() &&
+           memcmp(parent.c_str(), child.c_str(), parent.size()) == 0 &&
+           child.c_str()[parent.size()] == '/';
+  }
+
+  static const VariantData* getMember(const VariantData* op, const char* key) {
+    const VariantData* value = op->getMember(adaptString(key));
+    return value ? value->resolve() : 0;
+  }
+
+  static String getString(const VariantData* op, const char* key) {
+    const VariantData* value = getMember(op, key);
+    return value ? value->asString() : String();
+  }
+
+  VariantData* _root;
+  MemoryPool* _pool;
+};
+
+// Applies a JSON Patch (RFC 6902) to the document, in place.
+// Returns InvalidInput if the patch is malformed or if an operation fails, for
+// example, when a "test" fails, or when a path doesn't exist. Like the other
+// operations of ArduinoJson, it doesn't roll back, so the document stays
+// partially patched; patch a copy if you need to keep the original.
+inline DeserializationError applyJsonPatch(JsonDocument& doc,
+                                           VariantConstRef patch) {
+  return JsonPatcher(&doc.data(), &doc.memoryPool()).apply(getData(patch));
+}
+
+}  // namespace ARDUINOJSON_NAMESPACE
@@ -0,0 +1,183 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Document/JsonDocument.hpp>
+#include <ArduinoJson/Patch/jsonEquals.hpp>
+#include <ArduinoJson/StringStorage/StringCopier.hpp>
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// The path of the value being compared, as a linked list on the stack, so the
+// JSON Pointer is only built when an operation is written
+struct JsonDiffPath {
+  const JsonDiffPath* parent;
+  const VariantSlot* member;  // null for an element
+  size_t index;
+};
+
+// Writes the operations of a JSON Patch (RFC 6902) that turns the source into
+// the target.
+// Members are looked up starting after the previous one, so objects with the
+// same members in the same order are compared in lockstep. Arrays are compared
+// element by element: the extra elements are removed from the end, or added at
+// the end; an insertion in the middle replaces all the following elements.
+class JsonDiffer {
+ public:
+  JsonDiffer(CollectionData* ops, MemoryPool* pool)
+      : _ops(ops), _pool(pool), _copier(*pool) {}
+
+  bool diff(const VariantData* source, const VariantData* target,
+            const JsonDiffPath* path) {
+    if (source)
+      source = source->resolve();
+    if (target)
+      target = target->resolve();
+
+    if (variantKind(source) == variantKind(target)) {
+      if (source && source->isObject())
+        return diffObjects(*source->asObject(), *target->asObject(), path);
+      if (source && source->isArray())
+        return diffArrays(*source->asArray(), *target->asArray(), path);
+      if (VariantConstRef(source) == VariantConstRef(target))
+        return true;
+    }
+    return addOperation("replace", path, target);
+  }
+
+ private:
+  bool diffObjects(const CollectionData& source, const CollectionData& target,
+                   const JsonDiffPath* parent) {
+    VariantSlot* cursor = 0;
+    for (const VariantSlot* s = source.head(); s; s = s->next()) {
+      JsonDiffPath path = {parent, s, 0};
+      const VariantData* value = target.getMember(keyOf(s), cursor);
+      if (value ? !diff(s->data(), value, &path)
+                : !addOperation("remove", &path, 0))
+        return false;
+    }
+
+    cursor = 0;
+    for (const VariantSlot* s = target.head(); s; s = s->next()) {
+      JsonDiffPath path = {parent, s, 0};
+      if (!source.getMember(keyOf(s), cursor) &&
+          !addOperation("add", &path, s->data()))
+        return false;
+    }
+    return true;
+  }
+
+  bool diffArrays(const CollectionData& source, const CollectionData& target,
+                  const JsonDiffPath* parent) {
+    const VariantSlot* s = source.head();
+    const VariantSlot* t = target.head();
+    size_t index = 0;
+    for (; s && t; s = s->next(), t = t->next(), index++) {
+      JsonDiffPath path = {parent, 0, index};
+      if (!diff(s->data(), t->data(), &path))
+        return false;
+    }
+
+    // remove from the end, so the indexes of the other elements don't change
+    for (size_t i = source.size(); i > index; i--) {
+      JsonDiffPath path = {parent, 0, i - 1};
+      if (!addOperation("remove", &path, 0))
+        return false;
+    }
+
+    for (; t; t = t->next()) {
+      if (!addOperation("add", parent, t->data(), true))
+        return false;
+    }
+    return true;
+  }
+
+  bool addOperation(const char* op, const JsonDiffPath* path,
+                    const VariantData* value, bool append = false) {
+    _copier.startString();
+    writePath(path);
+    if (append)
+      _copier.append("/-");
+    if (!_copier.isValid())
+      return false;
+    String pathString = _copier.save();
+
+    VariantData* var = _ops->addElement(_pool);
+    if (!var)
+      return false;
+    CollectionData& obj = var->toObject();
+    VariantData* member = addMember(obj, "op");
+    if (!member)
+      return false;
+    member->setString(String(op, String::Linked));
+    member = addMember(obj, "path");
+    if (!member)
+      return false;
+    member->setString(pathString);
+    if (!value)
+      return true;
+    member = addMember(obj, "value");
+    return member && member->copyFrom(*value, _pool);
+  }
+
+  VariantData* addMember(CollectionData& obj, const char* key) {
+    return obj.addMember(adaptString(key), _pool, LinkStringStoragePolicy());
+  }
+
+  // Writes the JSON Pointer, escaping '~' and '/' in the keys
+  void writePath(const JsonDiffPath* path) {
+    if (!path)
+      return;
+    writePath(path->parent);
+    _copier.append('/');
+    if (path->member) {
+      const char* key = path->member->key();
+      for (size_t i = 0; i < path->member->keySize(); i++) {
+        if (key[i] == '~')
+          _copier.append("~0");
+        else if (key[i] == '/')
+          _copier.append("~1");
+        else
+          _copier.append(key[i]);
+      }
+    } else {
+      char digits[24];
+      char* p = digits + sizeof(digits);
+      size_t index = path->index;
+      do {
+        *--p = char('0' + index % 10);
+        index /= 10;
+      } while (index);
+      _copier.append(p, size_t(digits + sizeof(digits) - p));
+    }
+  }
+
+  static SizedRamString keyOf(const VariantSlot* slot) {
+    return adaptString(slot->key(), slot->keySize());
+  }
+
+  CollectionData* _ops;
+  MemoryPool* _pool;
+  StringCopier _copier;
+};
+
+// Writes in patch the JSON Patch (RFC 6902) that turns source into target.
+// The values of the "add" and "replace" operations are copied like set() does,
+// so the patch doesn't depend on target.
+// Returns false if the patch doesn't fit in the document.
+inline bool diffJson(VariantConstRef source, VariantConstRef target,
+                     JsonDocument& patch) {
+  VariantData null;
+  null.init();  // VariantData is a POD, so it has no constructor
+  const VariantData* targetData = getData(target);
+
+  patch.clear();
+  CollectionData& ops = patch.data().toArray();
+  JsonDiffer differ(&ops, &patch.memoryPool());
+  return differ.diff(getData(source), targetData ? targetData : &null, 0) &&
+         !patch.overflowed();
+}
+
+}  // namespace ARDUINOJSON_NAMESPACE
@@ -0,0 +1,60 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Variant/VariantData.hpp>
+#include <ArduinoJson/Variant/VariantRef.hpp>
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// The JSON type of a variant: two numbers have the same kind, but a boolean
+// and a number don't.
+inline uint8_t variantKind(const VariantData* var) {
+  if (!var)
+    return VALUE_IS_NULL;
+  if (var->isFloat())
+    return NUMBER_BIT;
+  return uint8_t(var->type() & ~OWNED_VALUE_BIT);
+}
+
+// Compares two values like RFC 6902 does: unlike operator==, true is not equal
+// to 1. Objects are compared in lockstep when the members are in the same
+// order, like ObjectConstRef::operator==.
+inline bool jsonEquals(const VariantData* a, const VariantData* b) {
+  if (a)
+    a = a->resolve();
+  if (b)
+    b = b->resolve();
+  if (variantKind(a) != variantKind(b))
+    return false;
+
+  if (a && a->isArray()) {
+    const VariantSlot* s1 = a->asArray()->head();
+    const VariantSlot* s2 = b->asArray()->head();
+    for (; s1 && s2; s1 = s1->next(), s2 = s2->next()) {
+      if (!jsonEquals(s1->data(), s2->data()))
+        return false;
+    }
+    return s1 == s2;
+  }
+
+  if (a && a->isObject()) {
+    const CollectionData* obj = b->asObject();
+    if (a->size() != b->size())
+      return false;
+    VariantSlot* cursor = 0;
+    for (const VariantSlot* s = a->asObject()->head(); s; s = s->next()) {
+      const VariantData* member =
+          obj->getMember(adaptString(s->key(), s->keySize()), cursor);
+      if (!member || !jsonEquals(s->data(), member))
+        return false;
+    }
+    return true;
+  }
+
+  return VariantConstRef(a) == VariantConstRef(b);
+}
+
+}  // namespace ARDUINOJSON_NAMESPACE
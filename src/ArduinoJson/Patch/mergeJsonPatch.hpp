@@ -0,0 +1,63 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Patch/jsonEquals.hpp>
+#include <ArduinoJson/Variant/VariantRef.hpp>
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// Merges the patch into the target, as defined by RFC 7396.
+// The members are looked up and removed starting after the previous one, so
+// objects in the same order are merged in one pass. Values that are already
+// equal aren't copied, linked strings stay linked, and strings that are
+// already in the pool are shared.
+inline bool variantMergePatch(VariantData* target, const VariantData* patch,
+                              MemoryPool* pool) {
+  patch = patch->resolve();
+  if (!patch->isObject()) {
+    if (jsonEquals(target, patch))
+      return true;
+    return target->copyFrom(*patch, pool);
+  }
+
+  if (target->isPointer())  // linked variants are read-only, see link()
+    target->copyFrom(*target->resolve(), pool);
+  if (!target->isObject())
+    target->toObject();
+
+  CollectionData* object = target->asObject();
+  VariantSlot* cursor = 0;
+  for (const VariantSlot* s = patch->asObject()->head(); s; s = s->next()) {
+    SizedRamString key = adaptString(s->key(), s->keySize());
+    if (s->data()->resolve()->isNull()) {
+      object->removeMember(key, cursor);
+      continue;
+    }
+    VariantData* member = object->getMember(key, cursor);
+    if (!member)
+      member = object->addMember(s->keyString(), pool);
+    if (!member || !variantMergePatch(member, s->data(), pool))
+      return false;
+  }
+  return true;
+}
+
+// Merges a JSON Merge Patch (RFC 7396) into the target, in place: the members
+// of the patch replace the members of the target, and the null members remove
+// them. Returns false if the document is full.
+inline bool mergeJsonPatch(VariantRef target, VariantConstRef patch) {
+  VariantData* data = getData(target);
+  if (!data)
+    return false;
+  const VariantData* patchData = getData(patch);
+  if (!patchData) {
+    data->setNull();
+    return true;
+  }
+  return variantMergePatch(data, patchData, getPool(target));
+}
+
+}  // namespace ARDUINOJSON_NAMESPACE
@@ -4,12 +4,15 @@
 
 #pragma once
 
+#include "integral_constant.hpp"
 #include "is_class.hpp"
 #include "is_convertible.hpp"
 #include "is_floating_point.hpp"
 #include "is_integral.hpp"
 #include "is_same.hpp"
 
+#include <stddef.h>  // size_t
+
 namespace ARDUINOJSON_NAMESPACE {
 
 template <typename T>
@@ -19,4 +22,8 @@ struct is_enum {
                             !is_floating_point<T>::value;
 };
 
+// declval() can't return an array
+template <typename T, size_t N>
+struct is_enum<T[N]> : false_type {};
+
 }  // namespace ARDUINOJSON_NAMESPACE
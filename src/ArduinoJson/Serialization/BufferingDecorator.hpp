@@ -0,0 +1,79 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Configuration.hpp>
+#include <ArduinoJson/Namespace.hpp>
+#include <ArduinoJson/Polyfills/type_traits.hpp>
+
+#include <string.h>  // memcpy
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// Tells whether the serializers should batch the writes to TDestination.
+// Streams (std::ostream, Print, custom writers) pay a price for each call to
+// write(), so we coalesce the bytes in a buffer on the stack.
+// Writers that append to memory (or that have their own buffer) opt out.
+template <typename TDestination, typename Enable = void>
+struct ShouldBufferWrites
+    : integral_constant<bool, (ARDUINOJSON_STREAM_BUFFER_SIZE > 0)> {};
+
+template <typename TWriter>
+class BufferingDecorator {
+  static const size_t bufferCapacity = ARDUINOJSON_STREAM_BUFFER_SIZE;
+
+ public:
+  explicit BufferingDecorator(TWriter& writer)
+      : _writer(writer), _size(0), _count(0) {}
+
+  ~BufferingDecorator() {
+    flush();
+  }
+
+  size_t write(uint8_t c) {
+    if (_size == bufferCapacity)
+      flush();
+    _buffer[_size++] = c;
+    return 1;
+  }
+
+  size_t write(const uint8_t* s, size_t n) {
+    if (_size + n > bufferCapacity) {
+      flush();
+      // too big for the buffer: send it as is
+      if (n >= bufferCapacity) {
+        _count += _writer.write(s, n);
+        return n;
+      }
+    }
+    memcpy(_buffer + _size, s, n);
+    _size += n;
+    return n;
+  }
+
+  void flush() {
+    if (_size == 0)
+      return;
+    _count += _writer.write(_buffer, _size);
+    _size = 0;
+  }
+
+  // Returns the number of bytes accepted by the TWriter implementation.
+  // Call flush() first to include the pending bytes.
+  size_t count() const {
+    return _count;
+  }
+
+ private:
+  BufferingDecorator(const BufferingDecorator&);  // non-copiable
+  BufferingDecorator& operator=(const BufferingDecorator&);
+
+  TWriter _writer;
+  uint8_t _buffer[bufferCapacity];
+  size_t _size;
+  size_t _count;
+};
+
+}  // namespace ARDUINOJSON_NAMESPACE
@@ -0,0 +1,57 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Serialization/Writer.hpp>
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// Holds the BufferingDecorator of a stream writer (see JsonStreamWriter), so
+// it's constructed before the serializer that uses it ("base-from-member"
+// idiom, like AllocatorOwner).
+// The destinations that opt out of ShouldBufferWrites get a plain Writer.
+template <typename TDestination,
+          bool = ShouldBufferWrites<TDestination>::value>
+class StreamWriterBuffer {
+ public:
+  typedef Writer<TDestination> writer_type;
+
+  explicit StreamWriterBuffer(TDestination& destination)
+      : _destination(&destination) {}
+
+  writer_type bufferWriter() {
+    return writer_type(*_destination);
+  }
+
+  void flushBuffer() {}
+
+ private:
+  TDestination* _destination;
+};
+
+template <typename TDestination>
+class StreamWriterBuffer<TDestination, true> {
+  typedef BufferingDecorator<Writer<TDestination> > buffer_type;
+
+ public:
+  typedef Writer<buffer_type> writer_type;
+
+  explicit StreamWriterBuffer(TDestination& destination)
+      : _writer(destination), _buffer(_writer) {}
+
+  writer_type bufferWriter() {
+    return writer_type(_buffer);
+  }
+
+  void flushBuffer() {
+    _buffer.flush();
+  }
+
+ private:
+  Writer<TDestination> _writer;
+  buffer_type _buffer;  // flushed by its destructor
+};
+
+}  // namespace ARDUINOJSON_NAMESPACE
@@ -0,0 +1,137 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Namespace.hpp>
+
+#include <stddef.h>  // size_t
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// Keeps track of the containers opened by a stream writer, so it can reject
+// the calls that would produce an invalid document.
+// Once a call is rejected, the writer refuses everything else.
+template <size_t maxDepth>
+class StreamWriterState {
+ public:
+  static const size_t unknownSize = size_t(-1);
+
+  StreamWriterState() : _depth(0), _complete(false), _failed(false) {}
+
+  bool failed() const {
+    return _failed;
+  }
+
+  // Tells whether the root value has been entirely written
+  bool complete() const {
+    return _complete;
+  }
+
+  bool inObject() const {
+    return _depth > 0 && top().isObject;
+  }
+
+  // Number of items (members or elements) written in the current container
+  size_t count() const {
+    return _depth > 0 ? top().count : 0;
+  }
+
+  // Must be called before writing a value, or opening a container
+  bool beginValue() {
+    if (_failed || _complete)
+      return fail();
+    if (_depth == 0)
+      return true;
+    const Level& level = top();
+    if (level.count == level.size)
+      return fail();  // more items than announced
+    if (level.isObject && level.expectsKey)
+      return fail();
+    return true;
+  }
+
+  // Must be called after writing a value, or closing a container
+  void endValue() {
+    if (_depth == 0) {
+      _complete = true;
+      return;
+    }
+    Level& level = top();
+    level.count++;
+    level.expectsKey = level.isObject;
+  }
+
+  // Must be called before writing a key
+  bool beginKey() {
+    if (_failed || !inObject() || !top().expectsKey ||
+        top().count == top().size)
+      return fail();
+    return true;
+  }
+
+  void endKey() {
+    top().expectsKey = false;
+  }
+
+  // Must be called after beginValue() and after writing the opening token
+  bool push(bool isObject, size_t size = unknownSize) {
+    if (_depth == maxDepth)
+      return fail();
+    Level& level = _levels[_depth++];
+    level.isObject = isObject;
+    level.expectsKey = isObject;
+    level.count = 0;
+    level.size = size;
+    return true;
+  }
+
+  // Must be called before writing the closing token
+  bool canPop(bool isObject) {
+    if (_failed || _depth == 0)
+      return fail();
+    const Level& level = top();
+    if (level.isObject != isObject)
+      return fail();
+    if (isObject && !level.expectsKey)
+      return fail();  // a key without a value
+    if (level.size != unknownSize && level.count != level.size)
+      return fail();  // fewer items than announced
+    return true;
+  }
+
+  void pop() {
+    _depth--;
+    endValue();
+  }
+
+ private:
+  struct Level {
+    size_t count;
+    size_t size;
+    bool isObject;
+    bool expectsKey;
+  };
+
+  bool fail() {
+    _failed = true;
+    return false;
+  }
+
+  Level& top() {
+    return _levels[_depth - 1];
+  }
+
+  const Level& top() const {
+    return _levels[_depth - 1];
+  }
+
+  // maxDepth == 0 allows a scalar root only; the array can't be empty though
+  Level _levels[maxDepth > 0 ? maxDepth : 1];
+  size_t _depth;
+  bool _complete;
+  bool _failed;
+};
+
+}  // namespace ARDUINOJSON_NAMESPACE
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <ArduinoJson/Namespace.hpp>
+#include <ArduinoJson/Serialization/BufferingDecorator.hpp>
 
 namespace ARDUINOJSON_NAMESPACE {
 
@@ -8,6 +8,10 @@
 
 namespace ARDUINOJSON_NAMESPACE {
 
+// This writer has its own buffer
+template <>
+struct ShouldBufferWrites< ::String, void> : false_type {};
+
 template <>
 class Writer< ::String, void> {
   static const size_t bufferCapacity = ARDUINOJSON_STRING_BUFFER_SIZE;
@@ -8,25 +8,57 @@
 
 namespace ARDUINOJSON_NAMESPACE {
 
+// Writes to the streambuf directly, to avoid constructing a sentry for each
+// character. The state of the stream is updated as std::ostream would.
 template <typename TDestination>
 class Writer<
     TDestination,
     typename enable_if<is_base_of<std::ostream, TDestination>::value>::type> {
  public:
-  explicit Writer(std::ostream& os) : _os(&os) {}
+  explicit Writer(std::ostream& os) : _os(&os), _buf(0) {
+    // checks the state and flushes the tied stream, only once
+    std::ostream::sentry ok(os);
+    if (ok)
+      _buf = os.rdbuf();
+  }
 
   size_t write(uint8_t c) {
-    _os->put(static_cast<char>(c));
+    if (!_buf)
+      return 0;
+    if (std::streambuf::traits_type::eq_int_type(
+            _buf->sputc(static_cast<char>(c)),
+            std::streambuf::traits_type::eof())) {
+      setBad();
+      return 0;
+    }
+    flushIfUnitbuf();
     return 1;
   }
 
   size_t write(const uint8_t* s, size_t n) {
-    _os->write(reinterpret_cast<const char*>(s),
-               static_cast<std::streamsize>(n));
-    return n;
+    if (!_buf)
+      return 0;
+    std::streamsize written = _buf->sputn(reinterpret_cast<const char*>(s),
+                                          static_cast<std::streamsize>(n));
+    if (written < static_cast<std::streamsize>(n))
+      setBad();
+    flushIfUnitbuf();
+    return static_cast<size_t>(written);
   }
 
  private:
+  void setBad() {
+    _buf = 0;
+    _os->setstate(std::ios::badbit);
+  }
+
+  // std::cerr must be flushed after each output operation
+  void flushIfUnitbuf() {
+    if (_buf && (_os->flags() & std::ios::unitbuf) && _buf->pubsync() == -1)
+      setBad();
+  }
+
   std::ostream* _os;
+  std::streambuf* _buf;
 };
 }  // namespace ARDUINOJSON_NAMESPACE
@@ -18,6 +18,11 @@ template <class TCharTraits, class TAllocator>
 struct is_std_string<std::basic_string<char, TCharTraits, TAllocator> >
     : true_type {};
 
+template <typename TDestination>
+struct ShouldBufferWrites<
+    TDestination, typename enable_if<is_std_string<TDestination>::value>::type>
+    : false_type {};
+
 template <typename TDestination>
 class Writer<TDestination,
              typename enable_if<is_std_string<TDestination>::value>::type> {
@@ -8,8 +8,8 @@
 
 namespace ARDUINOJSON_NAMESPACE {
 
-template <template <typename> class TSerializer>
-size_t measure(VariantConstRef source) {
+template <template <typename> class TSerializer, typename TSource>
+size_t measure(const TSource &source) {
   DummyWriter dp;
   TSerializer<DummyWriter> serializer(dp);
   return source.accept(serializer);
@@ -0,0 +1,76 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Misc/SerializedValue.hpp>
+#include <ArduinoJson/Misc/Visitable.hpp>
+#include <ArduinoJson/Numbers/Float.hpp>
+#include <ArduinoJson/Numbers/Integer.hpp>
+#include <ArduinoJson/Polyfills/type_traits.hpp>
+#include <ArduinoJson/Strings/StringAdapters.hpp>
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// Sends a value to a serializer without storing it in a JsonDocument.
+// Used by the stream writers.
+
+template <typename TVisitor>
+inline void writeValue(TVisitor& visitor, bool value) {
+  visitor.visitBoolean(value);
+}
+
+template <typename TVisitor, typename T>
+inline typename enable_if<is_integral<T>::value && is_signed<T>::value>::type
+writeValue(TVisitor& visitor, T value) {
+  visitor.visitSignedInteger(static_cast<Integer>(value));
+}
+
+template <typename TVisitor, typename T>
+inline typename enable_if<is_integral<T>::value && is_unsigned<T>::value &&
+                          !is_same<bool, T>::value>::type
+writeValue(TVisitor& visitor, T value) {
+  visitor.visitUnsignedInteger(static_cast<UInt>(value));
+}
+
+template <typename TVisitor, typename T>
+inline typename enable_if<is_floating_point<T>::value>::type writeValue(
+    TVisitor& visitor, T value) {
+  visitor.visitFloat(static_cast<Float>(value));
+}
+
+template <typename TVisitor, typename TAdaptedString>
+inline void writeAdaptedString(TVisitor& visitor, TAdaptedString s) {
+  if (s.isNull())
+    visitor.visitNull();
+  else
+    visitor.visitString(s.data(), s.size());
+}
+
+// const char*, char*, const unsigned char*...
+template <typename TVisitor, typename TChar>
+inline void writeValue(TVisitor& visitor, TChar* value) {
+  writeAdaptedString(visitor, adaptString(value));
+}
+
+// std::string, String, std::string_view, JsonString...
+template <typename TVisitor, typename TString>
+inline typename enable_if<IsString<TString>::value>::type writeValue(
+    TVisitor& visitor, const TString& value) {
+  writeAdaptedString(visitor, adaptString(value));
+}
+
+// JsonVariantConst, JsonObject, JsonDocument...
+template <typename TVisitor, typename TSource>
+inline typename enable_if<IsVisitable<TSource>::value>::type writeValue(
+    TVisitor& visitor, const TSource& value) {
+  value.accept(visitor);
+}
+
+template <typename TVisitor, typename T>
+inline void writeValue(TVisitor& visitor, SerializedValue<T> value) {
+  visitor.visitRawJson(value.data(), value.size());
+}
+
+}  // namespace ARDUINOJSON_NAMESPACE
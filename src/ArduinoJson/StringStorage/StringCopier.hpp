@@ -6,6 +6,8 @@
 
 #include <ArduinoJson/Memory/MemoryPool.hpp>
 
+#include <string.h>  // memcpy
+
 namespace ARDUINOJSON_NAMESPACE {
 
 class StringCopier {
@@ -25,12 +27,26 @@ class StringCopier {
     return String(_pool->saveStringFromFreeZone(_size), _size, String::Copied);
   }
 
+  // Same as save(), except that a key found in the dictionary of the pool
+  // isn't copied: the returned string points to the entry
+  String saveKey() {
+    const JsonKeyDictionary* dictionary = _pool->keyDictionary();
+    if (dictionary) {
+      const char* entry = dictionary->find(_ptr, _size);
+      if (entry)
+        return String(entry, _size, String::Linked);
+    }
+    return save();
+  }
+
   void append(const char* s) {
     while (*s) append(*s++);
   }
 
   void append(const char* s, size_t n) {
-    while (n-- > 0) append(*s++);
+    char* p = reserve(n);
+    if (p)
+      memcpy(p, s, n);
   }
 
   void append(char c) {
@@ -40,6 +56,18 @@ class StringCopier {
       _pool->markAsOverflowed();
   }
 
+  // Extends the string by n chars and returns a pointer to them, so the caller
+  // can fill them in place. Returns null if there is not enough room.
+  char* reserve(size_t n) {
+    if (n >= _capacity - _size) {  // needs room for the terminator
+      _pool->markAsOverflowed();
+      return 0;
+    }
+    char* p = _ptr + _size;
+    _size += n;
+    return p;
+  }
+
   bool isValid() const {
     return !_pool->overflowed();
   }
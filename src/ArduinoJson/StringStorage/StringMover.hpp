@@ -23,10 +23,21 @@ class StringMover {
     return s;
   }
 
+  // Keys are never copied, so there is no need for a dictionary
+  FORCE_INLINE String saveKey() {
+    return save();
+  }
+
   void append(char c) {
     *_writePtr++ = c;
   }
 
+  char* reserve(size_t n) {
+    char* p = _writePtr;
+    _writePtr += n;
+    return p;
+  }
+
   bool isValid() const {
     return true;
   }
@@ -48,6 +48,10 @@ class ZeroTerminatedRamString {
     return stringCompare(a, b) == 0;
   }
 
+  friend bool stringPointsTo(ZeroTerminatedRamString s, const char* p) {
+    return s._str == p;
+  }
+
  protected:
   const char* _str;
 };
@@ -0,0 +1,79 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Strings/StringAdapters.hpp>
+
+#include <string.h>  // strlen
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// A key for the lookups on the hot path. Its size and its hash are computed
+// once, when it's constructed, so the lookups don't call strlen(), and they
+// skip the members whose hash differs (see ARDUINOJSON_SLOT_KEY_HASH):
+//
+//   static const JsonKey temperature("temperature");
+//   float t = doc["sensor"][temperature];
+//
+// The string must outlive the JsonKey; when a lookup adds a member, the key
+// is copied in the document.
+class JsonKey {
+ public:
+  static const size_t typeSortKey = 2;
+
+  explicit JsonKey(const char* s)
+      : _str(s), _size(s ? strlen(s) : 0), _hash(computeHash()) {}
+
+  JsonKey(const char* s, size_t n) : _str(s), _size(n), _hash(computeHash()) {}
+
+  bool isNull() const {
+    return !_str;
+  }
+
+  size_t size() const {
+    return _size;
+  }
+
+  char operator[](size_t i) const {
+    ARDUINOJSON_ASSERT(_str != 0);
+    ARDUINOJSON_ASSERT(i <= _size);
+    return _str[i];
+  }
+
+  const char* data() const {
+    return _str;
+  }
+
+  uint8_t hash() const {
+    return _hash;
+  }
+
+  friend uint8_t stringHash(const JsonKey& key) {
+    return key._hash;
+  }
+
+  // Same pointer and same size, for example, with a JsonKeyDictionary
+  friend bool stringPointsTo(const JsonKey& key, const char* p) {
+    return key._str == p && p[key._size] == 0;
+  }
+
+ private:
+  uint8_t computeHash() const {
+    return _str ? stringHash(SizedRamString(_str, _size)) : 0;
+  }
+
+  const char* _str;
+  size_t _size;
+  uint8_t _hash;
+};
+
+template <>
+struct IsString<JsonKey> : true_type {};
+
+inline JsonKey adaptString(const JsonKey& key) {
+  return key;
+}
+
+}  // namespace ARDUINOJSON_NAMESPACE
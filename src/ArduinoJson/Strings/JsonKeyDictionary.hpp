@@ -0,0 +1,89 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Polyfills/assert.hpp>
+#include <ArduinoJson/Strings/StringAdapters.hpp>
+
+#include <stddef.h>  // size_t
+#include <string.h>  // strlen
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// A fixed vocabulary of keys, known in advance:
+//
+//   const char* const keys[] = {"humidity", "id", "temperature", "unit"};
+//   JsonKeyDictionary dictionary(keys);
+//   doc.setKeyDictionary(&dictionary);
+//
+// When a document has a dictionary, the deserializers store the keys that are
+// in the dictionary as pointers to the entries, instead of copying them in the
+// memory pool. Looking up a member with the entry itself (for example,
+// doc[keys[2]]) compares the pointers first.
+//
+// The entries must be sorted in ascending order, and they must outlive the
+// documents that use them.
+class JsonKeyDictionary {
+ public:
+  template <size_t N>
+  JsonKeyDictionary(const char* const (&entries)[N])
+      : _keys(entries), _size(N) {
+    ARDUINOJSON_ASSERT(isSorted());
+  }
+
+  JsonKeyDictionary(const char* const* entries, size_t count)
+      : _keys(entries), _size(count) {
+    ARDUINOJSON_ASSERT(isSorted());
+  }
+
+  // Returns the entry equal to the string, or null if there is none
+  const char* find(const char* s) const {
+    return s ? find(s, strlen(s)) : 0;
+  }
+
+  const char* find(const char* s, size_t n) const {
+    // binary search
+    size_t begin = 0, end = _size;
+    while (begin < end) {
+      size_t middle = begin + (end - begin) / 2;
+      int cmp = compare(s, n, _keys[middle]);
+      if (cmp == 0)
+        return _keys[middle];
+      if (cmp < 0)
+        end = middle;
+      else
+        begin = middle + 1;
+    }
+    return 0;
+  }
+
+  size_t size() const {
+    return _size;
+  }
+
+  // Tells whether the entries are in the order expected by find()
+  bool isSorted() const {
+    return isSorted(_keys, _size);
+  }
+
+  // Same, before constructing a dictionary, which asserts it
+  static bool isSorted(const char* const* entries, size_t count) {
+    for (size_t i = 1; i < count; i++) {
+      if (compare(entries[i - 1], strlen(entries[i - 1]), entries[i]) >= 0)
+        return false;
+    }
+    return true;
+  }
+
+ private:
+  static int compare(const char* s, size_t n, const char* entry) {
+    return stringCompare(adaptString(s, n), adaptString(entry));
+  }
+
+  const char* const* _keys;
+  size_t _size;
+};
+
+}  // namespace ARDUINOJSON_NAMESPACE
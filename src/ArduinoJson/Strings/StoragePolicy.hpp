@@ -23,6 +23,16 @@ struct CopyStringStoragePolicy {
   bool store(TAdaptedString str, MemoryPool *pool, TCallback callback);
 };
 
+// For a string that is already in the pool: refers to it, without copying it
+struct SharedStringStoragePolicy {
+  template <typename TAdaptedString, typename TCallback>
+  bool store(TAdaptedString str, MemoryPool *, TCallback callback) {
+    String storedString(str.data(), str.size(), String::Copied);
+    callback(storedString);
+    return !str.isNull();
+  }
+};
+
 class LinkOrCopyStringStoragePolicy : LinkStringStoragePolicy,
                                       CopyStringStoragePolicy {
  public:
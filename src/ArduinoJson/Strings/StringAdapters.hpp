@@ -24,6 +24,8 @@
 #  include <ArduinoJson/Strings/Adapters/FlashString.hpp>
 #endif
 
+#include <stdint.h>  // uint32_t
+
 namespace ARDUINOJSON_NAMESPACE {
 
 template <typename TAdaptedString1, typename TAdaptedString2>
@@ -77,6 +79,39 @@ stringEquals(TAdaptedString1 s1, TAdaptedString2 s2) {
   return stringEquals(s2, s1);
 }
 
+// Same as stringEquals(), when the sizes are known to be equal
+template <typename TAdaptedString>
+bool stringEquals(TAdaptedString s, const char* p, size_t n) {
+  ARDUINOJSON_ASSERT(!s.isNull());
+  ARDUINOJSON_ASSERT(p != 0);
+  for (size_t i = 0; i < n; i++) {
+    if (s[i] != p[i])
+      return false;
+  }
+  return true;
+}
+
+// An 8-bit hash of the string (FNV-1a, folded), stored in each slot to skip
+// most of the mismatching keys; see ARDUINOJSON_SLOT_KEY_HASH
+template <typename TAdaptedString>
+uint8_t stringHash(TAdaptedString s) {
+  uint32_t hash = 2166136261UL;
+  size_t n = s.size();
+  for (size_t i = 0; i < n; i++) {
+    hash ^= static_cast<uint8_t>(s[i]);
+    hash *= 16777619UL;
+  }
+  return static_cast<uint8_t>(hash ^ (hash >> 8) ^ (hash >> 16) ^
+                              (hash >> 24));
+}
+
+// Tells whether the string is at this address, which is a quick way to tell
+// that two strings are equal, for example, with a JsonKeyDictionary
+template <typename TAdaptedString>
+bool stringPointsTo(TAdaptedString, const char*) {
+  return false;
+}
+
 template <typename TAdaptedString>
 static void stringGetChars(TAdaptedString s, char* p, size_t n) {
   ARDUINOJSON_ASSERT(s.size() <= n);
@@ -0,0 +1,92 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Strings/String.hpp>
+
+#include <stddef.h>  // size_t
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// Replaces the StringCopier when deserializing a struct: the characters go
+// straight to the field, either a char array or a string class.
+class FieldStringStorage {
+ public:
+  FieldStringStorage()
+      : _string(0),
+        _append(0),
+        _buffer(0),
+        _capacity(0),
+        _size(0),
+        _truncated(false),
+        _canTruncate(false) {}
+
+  // Writes to a char array.
+  // If canTruncate is false, isValid() returns false when the string doesn't
+  // fit, so the deserializer returns NoMemory.
+  void setTarget(char *buffer, size_t capacity, bool canTruncate) {
+    _string = 0;
+    _append = 0;
+    _buffer = buffer;
+    _capacity = capacity;
+    _canTruncate = canTruncate;
+    _size = 0;
+    _buffer[0] = 0;
+  }
+
+  // Writes to a std::string or an Arduino String, after clearing it
+  template <typename TString>
+  void setTarget(TString &target) {
+    target = TString();
+    _string = &target;
+    _append = &appendTo<TString>;
+    _buffer = 0;
+  }
+
+  void startString() {
+    _size = 0;
+    _truncated = false;
+  }
+
+  void append(char c) {
+    if (_append) {
+      _append(_string, c);
+    } else if (_size + 1 < _capacity) {
+      _buffer[_size++] = c;
+      _buffer[_size] = 0;
+    } else {
+      _truncated = true;
+    }
+  }
+
+  bool isValid() const {
+    return _canTruncate || !_truncated;
+  }
+
+  bool truncated() const {
+    return _truncated;
+  }
+
+  // The content of the char array
+  String str() const {
+    return String(_buffer, _size, String::Linked);
+  }
+
+ private:
+  template <typename TString>
+  static void appendTo(void *target, char c) {
+    *static_cast<TString *>(target) += c;
+  }
+
+  void *_string;
+  void (*_append)(void *, char);
+  char *_buffer;
+  size_t _capacity;
+  size_t _size;
+  bool _truncated;
+  bool _canTruncate;
+};
+
+}  // namespace ARDUINOJSON_NAMESPACE
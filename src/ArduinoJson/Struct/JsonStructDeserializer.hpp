@@ -0,0 +1,497 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Json/JsonDeserializer.hpp>
+#include <ArduinoJson/Json/JsonSerializer.hpp>
+#include <ArduinoJson/Struct/FieldStringStorage.hpp>
+#include <ArduinoJson/Transcoding/TranscoderPool.hpp>
+
+#include <string.h>  // memcmp
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// Passed to jsonFields() for each key of the object.
+// Only the field whose name matches the key parses the value; the others
+// just compare the length of their name, which is known at compile time.
+template <typename TDeserializer>
+class JsonFieldReader {
+ public:
+  JsonFieldReader(TDeserializer *deserializer, String key,
+                  NestingLimit nestingLimit)
+      : _deserializer(deserializer),
+        _key(key),
+        _nestingLimit(nestingLimit),
+        _state(Pending) {}
+
+  template <size_t N, typename T>
+  void operator()(const char (&name)[N], T &value) {
+    if (_state != Pending || _key.size() != N - 1 ||
+        memcmp(name, _key.c_str(), N - 1) != 0)
+      return;
+    _state = _deserializer->parseField(value, _nestingLimit) ? Parsed : Failed;
+  }
+
+  bool found() const {
+    return _state != Pending;
+  }
+
+  bool failed() const {
+    return _state == Failed;
+  }
+
+ private:
+  enum State { Pending, Parsed, Failed };
+
+  TDeserializer *_deserializer;
+  String _key;
+  NestingLimit _nestingLimit;
+  State _state;
+};
+
+// Deserializes JSON straight into the fields of a struct, without a
+// JsonDocument. The struct declares its fields with jsonFields(); see
+// deserializeJsonStruct().
+template <typename TReader>
+class JsonStructDeserializer
+    : private TranscoderPool,
+      private JsonDeserializer<TReader, FieldStringStorage> {
+  typedef JsonDeserializer<TReader, FieldStringStorage> base;
+
+ public:
+  JsonStructDeserializer(TReader reader)
+      : base(_pool, reader, FieldStringStorage()) {}
+
+  template <typename T>
+  DeserializationError parse(T &dst, NestingLimit nestingLimit) {
+    if (!base::skipSpacesAndComments())
+      return base::_error;
+
+    char first = base::current();
+
+    if (!parseField(dst, nestingLimit))
+      return base::_error;
+
+    bool isEnclosed = first == '[' || first == '{' || base::isQuote(first);
+    if (base::_latch.last() != 0 && !isEnclosed) {
+      // We don't detect trailing characters earlier, so we need to check now
+      return DeserializationError::InvalidInput;
+    }
+
+    return DeserializationError::Ok;
+  }
+
+ private:
+  friend class JsonFieldReader<JsonStructDeserializer>;
+
+  // Nested struct
+  template <typename T>
+  typename enable_if<is_class<T>::value, bool>::type parseField(
+      T &dst, NestingLimit nestingLimit) {
+    if (!base::skipSpacesAndComments())
+      return false;
+
+    if (base::current() != '{')
+      return base::skipVariant(nestingLimit);
+
+    if (nestingLimit.reached()) {
+      base::_error = DeserializationError::TooDeep;
+      return false;
+    }
+
+    // Skip opening brace
+    base::move();
+
+    // Skip spaces
+    if (!base::skipSpacesAndComments())
+      return false;
+
+    // Empty object?
+    if (base::eat('}'))
+      return true;
+
+    // Read each key value pair
+    for (;;) {
+      // Parse key in the internal buffer, since it's only used for matching
+      base::_stringStorage.setTarget(base::_buffer, sizeof(base::_buffer),
+                                     true);
+      if (!base::parseKey())
+        return false;
+      bool keyIsComplete = !base::_stringStorage.truncated();
+      String key = base::_stringStorage.str();
+
+      // Skip spaces
+      if (!base::skipSpacesAndComments())
+        return false;
+
+      // Colon
+      if (!base::eat(':')) {
+        base::_error = DeserializationError::InvalidInput;
+        return false;
+      }
+
+      // Parse value in the matching field, or skip it
+      JsonFieldReader<JsonStructDeserializer> reader(this, key,
+                                                    nestingLimit.decrement());
+      if (keyIsComplete)
+        jsonFields(dst, reader);  // Error here? Declare jsonFields() for T
+      if (reader.failed())
+        return false;
+      if (!reader.found() && !base::skipVariant(nestingLimit.decrement()))
+        return false;
+
+      // Skip spaces
+      if (!base::skipSpacesAndComments())
+        return false;
+
+      // More keys/values?
+      if (base::eat('}'))
+        return true;
+      if (!base::eat(',')) {
+        base::_error = DeserializationError::InvalidInput;
+        return false;
+      }
+
+      // Skip spaces
+      if (!base::skipSpacesAndComments())
+        return false;
+    }
+  }
+
+  // Fixed-size array: extra elements are skipped
+  template <typename T, size_t N>
+  bool parseField(T (&dst)[N], NestingLimit nestingLimit) {
+    if (!base::skipSpacesAndComments())
+      return false;
+
+    if (base::current() != '[')
+      return base::skipVariant(nestingLimit);
+
+    if (nestingLimit.reached()) {
+      base::_error = DeserializationError::TooDeep;
+      return false;
+    }
+
+    // Skip opening braket
+    base::move();
+
+    // Skip spaces
+    if (!base::skipSpacesAndComments())
+      return false;
+
+    // Empty array?
+    if (base::eat(']'))
+      return true;
+
+    // Read each value
+    for (size_t i = 0;; i++) {
+      if (i < N) {
+        if (!parseField(dst[i], nestingLimit.decrement()))
+          return false;
+      } else {
+        if (!base::skipVariant(nestingLimit.decrement()))
+          return false;
+      }
+
+      // Skip spaces
+      if (!base::skipSpacesAndComments())
+        return false;
+
+      // More values?
+      if (base::eat(']'))
+        return true;
+      if (!base::eat(',')) {
+        base::_error = DeserializationError::InvalidInput;
+        return false;
+      }
+    }
+  }
+
+  // Char array: the string must fit, including the terminator
+  template <size_t N>
+  bool parseField(char (&dst)[N], NestingLimit nestingLimit) {
+    base::_stringStorage.setTarget(dst, N, false);
+    return parseString(nestingLimit);
+  }
+
+#if ARDUINOJSON_ENABLE_STD_STRING
+  bool parseField(std::string &dst, NestingLimit nestingLimit) {
+    return parseStringObject(dst, nestingLimit);
+  }
+#endif
+
+#if ARDUINOJSON_ENABLE_ARDUINO_STRING
+  bool parseField(::String &dst, NestingLimit nestingLimit) {
+    return parseStringObject(dst, nestingLimit);
+  }
+#endif
+
+  bool parseField(bool &dst, NestingLimit nestingLimit) {
+    VariantData value;
+    value.init();  // VariantData is a POD, so it has no constructor
+    if (!parseScalar(value, nestingLimit))
+      return false;
+    dst = value.asBoolean();
+    return true;
+  }
+
+  template <typename T>
+  typename enable_if<is_integral<T>::value && !is_same<bool, T>::value &&
+                         !is_same<char, T>::value,
+                     bool>::type
+  parseField(T &dst, NestingLimit nestingLimit) {
+    ARDUINOJSON_ASSERT_INTEGER_TYPE_IS_SUPPORTED(T);
+    VariantData value;
+    value.init();
+    if (!parseScalar(value, nestingLimit))
+      return false;
+    dst = value.asIntegral<T>();
+    return true;
+  }
+
+  template <typename T>
+  typename enable_if<is_enum<T>::value, bool>::type parseField(
+      T &dst, NestingLimit nestingLimit) {
+    VariantData value;
+    value.init();
+    if (!parseScalar(value, nestingLimit))
+      return false;
+    dst = static_cast<T>(value.asIntegral<int>());
+    return true;
+  }
+
+  template <typename T>
+  typename enable_if<is_floating_point<T>::value, bool>::type parseField(
+      T &dst, NestingLimit nestingLimit) {
+    VariantData value;
+    value.init();
+    if (!parseScalar(value, nestingLimit))
+      return false;
+    dst = value.asFloat<T>();
+    return true;
+  }
+
+  // Reads the value as deserializeJson() would, except that arrays and
+  // objects are skipped, so that the field gets the same value as with
+  // as<T>(). A string goes in the internal buffer and is truncated if
+  // needed.
+  bool parseScalar(VariantData &value, NestingLimit nestingLimit) {
+    if (!base::skipSpacesAndComments())
+      return false;
+
+    switch (base::current()) {
+      case '[':
+      case '{':
+        return base::skipVariant(nestingLimit);
+
+      case '\"':
+      case '\'':
+        base::_stringStorage.setTarget(base::_buffer, sizeof(base::_buffer),
+                                       true);
+        if (!parseString(nestingLimit))
+          return false;
+        value.setString(base::_stringStorage.str());
+        return true;
+
+      default:
+        return base::parseNumericValue(value);
+    }
+  }
+
+  // Like as<std::string>(), a value that isn't a string is serialized
+  template <typename TString>
+  bool parseStringObject(TString &dst, NestingLimit nestingLimit) {
+    if (!base::skipSpacesAndComments())
+      return false;
+
+    if (base::isQuote(base::current())) {
+      base::_stringStorage.setTarget(dst);
+      base::_stringStorage.startString();
+      return base::parseQuotedString();
+    }
+
+    dst = TString();
+    return reserializeVariant(dst, nestingLimit);
+  }
+
+  // Appends the value to dst, as serializeJson() would write it
+  template <typename TString>
+  bool reserializeVariant(TString &dst, NestingLimit nestingLimit) {
+    if (!base::skipSpacesAndComments())
+      return false;
+
+    char open = base::current();
+    if (base::isQuote(open))
+      return reserializeString(dst, false);
+    if (open != '[' && open != '{') {
+      VariantData value;
+      value.init();
+      if (!base::parseNumericValue(value))
+        return false;
+      serializeJson(VariantConstRef(&value), dst);
+      return true;
+    }
+
+    if (nestingLimit.reached()) {
+      base::_error = DeserializationError::TooDeep;
+      return false;
+    }
+
+    bool isObject = open == '{';
+    char close = isObject ? '}' : ']';
+    base::move();
+    dst += open;
+
+    // Skip spaces
+    if (!base::skipSpacesAndComments())
+      return false;
+
+    // Empty container?
+    if (base::eat(close)) {
+      dst += close;
+      return true;
+    }
+
+    for (;;) {
+      if (isObject) {
+        if (!reserializeString(dst, true))
+          return false;
+
+        // Skip spaces
+        if (!base::skipSpacesAndComments())
+          return false;
+
+        // Colon
+        if (!base::eat(':')) {
+          base::_error = DeserializationError::InvalidInput;
+          return false;
+        }
+        dst += ':';
+      }
+
+      if (!reserializeVariant(dst, nestingLimit.decrement()))
+        return false;
+
+      // Skip spaces
+      if (!base::skipSpacesAndComments())
+        return false;
+
+      // More values?
+      if (base::eat(close)) {
+        dst += close;
+        return true;
+      }
+      if (!base::eat(',')) {
+        base::_error = DeserializationError::InvalidInput;
+        return false;
+      }
+      dst += ',';
+
+      // Skip spaces
+      if (!base::skipSpacesAndComments())
+        return false;
+    }
+  }
+
+  // Appends the string to dst, quoted and escaped
+  template <typename TString>
+  bool reserializeString(TString &dst, bool isKey) {
+    TString str;
+    base::_stringStorage.setTarget(str);
+    base::_stringStorage.startString();
+    if (!(isKey ? base::parseKey() : base::parseQuotedString()))
+      return false;
+    VariantData value;
+    value.init();
+    value.setString(
+        String(str.c_str(), adaptString(str).size(), String::Linked));
+    serializeJson(VariantConstRef(&value), dst);
+    return true;
+  }
+
+  // Values that are not strings leave the target empty
+  bool parseString(NestingLimit nestingLimit) {
+    if (!base::skipSpacesAndComments())
+      return false;
+
+    if (!base::isQuote(base::current()))
+      return base::skipVariant(nestingLimit);
+
+    base::_stringStorage.startString();
+    return base::parseQuotedString();
+  }
+};
+
+// Deserializes JSON in a struct (or a class) that declares its fields with a
+// jsonFields() function in its namespace:
+//
+//   struct Config {
+//     char host[32];
+//     int port;
+//   };
+//
+//   template <typename TFields>
+//   void jsonFields(Config& config, TFields& fields) {
+//     fields("host", config.host);
+//     fields("port", config.port);
+//   }
+//
+//   deserializeJsonStruct(config, input);
+//
+// Each field gets the value that doc[key].as<T>() would return. Fields can be
+// bool, integers, enums, floats, char arrays, std::string, String, other
+// structs with a jsonFields(), and fixed-size arrays of those. Like as<T>(),
+// std::string and String fields get the JSON of a value that isn't a string.
+// Fields that are missing from the input keep their value; unknown keys are
+// skipped. Nothing is allocated, but a char array field must be big enough for
+// the string, otherwise the function returns NoMemory.
+
+//
+// deserializeJsonStruct(T&, const std::string&, ...)
+//
+template <typename T, typename TString>
+typename enable_if<!is_array<TString>::value, DeserializationError>::type
+deserializeJsonStruct(T &dst, const TString &input,
+                      NestingLimit nestingLimit = NestingLimit()) {
+  Reader<TString> reader(input);
+  return JsonStructDeserializer<Reader<TString> >(reader).parse(dst,
+                                                               nestingLimit);
+}
+
+//
+// deserializeJsonStruct(T&, std::istream&, ...)
+//
+template <typename T, typename TStream>
+DeserializationError deserializeJsonStruct(
+    T &dst, TStream &input, NestingLimit nestingLimit = NestingLimit()) {
+  Reader<TStream> reader(input);
+  return JsonStructDeserializer<Reader<TStream> >(reader).parse(dst,
+                                                               nestingLimit);
+}
+
+//
+// deserializeJsonStruct(T&, char*, ...)
+//
+template <typename T, typename TChar>
+DeserializationError deserializeJsonStruct(
+    T &dst, TChar *input, NestingLimit nestingLimit = NestingLimit()) {
+  Reader<TChar *> reader(input);
+  return JsonStructDeserializer<Reader<TChar *> >(reader).parse(dst,
+                                                               nestingLimit);
+}
+
+//
+// deserializeJsonStruct(T&, char*, size_t, ...)
+//
+template <typename T, typename TChar>
+DeserializationError deserializeJsonStruct(
+    T &dst, TChar *input, size_t inputSize,
+    NestingLimit nestingLimit = NestingLimit()) {
+  BoundedReader<TChar *> reader(input, inputSize);
+  return JsonStructDeserializer<BoundedReader<TChar *> >(reader).parse(
+      dst, nestingLimit);
+}
+
+}  // namespace ARDUINOJSON_NAMESPACE
@@ -0,0 +1,84 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Json/JsonSerializer.hpp>
+#include <ArduinoJson/Struct/StructSerializer.hpp>
+
+namespace ARDUINOJSON_NAMESPACE {
+
+template <typename TWriter>
+class JsonStructFormat : private JsonSerializer<TWriter> {
+  typedef JsonSerializer<TWriter> base;
+
+ protected:
+  JsonStructFormat(TWriter writer) : base(writer) {}
+
+  base &visitor() {
+    return *this;
+  }
+
+  size_t bytesWritten() const {
+    return base::bytesWritten();
+  }
+
+  template <typename T>
+  void beginObject(T &) {
+    base::write('{');
+  }
+
+  void endObject() {
+    base::write('}');
+  }
+
+  void beginArray(size_t) {
+    base::write('[');
+  }
+
+  void endArray() {
+    base::write(']');
+  }
+
+  void writeSeparator() {
+    base::write(',');
+  }
+
+  template <size_t N>
+  void writeKey(const char (&name)[N]) {
+    base::visitString(name, N - 1);
+    base::write(':');
+  }
+};
+
+template <typename TWriter>
+class JsonStructSerializer
+    : public StructSerializer<JsonStructFormat<TWriter> > {
+ public:
+  static const bool producesText = true;
+
+  JsonStructSerializer(TWriter writer)
+      : StructSerializer<JsonStructFormat<TWriter> >(writer) {}
+};
+
+// Serializes a struct declared with jsonFields() (see deserializeJsonStruct())
+// without a JsonDocument. The output is the same as with convertToJson() and
+// serializeJson().
+
+template <typename T, typename TDestination>
+size_t serializeJsonStruct(const T &source, TDestination &destination) {
+  return serializeStruct<JsonStructSerializer>(source, destination);
+}
+
+template <typename T>
+size_t serializeJsonStruct(const T &source, void *buffer, size_t bufferSize) {
+  return serializeStruct<JsonStructSerializer>(source, buffer, bufferSize);
+}
+
+template <typename T>
+size_t measureJsonStruct(const T &source) {
+  return measureStruct<JsonStructSerializer>(source);
+}
+
+}  // namespace ARDUINOJSON_NAMESPACE
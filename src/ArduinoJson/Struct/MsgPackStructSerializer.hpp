@@ -0,0 +1,100 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/MsgPack/MsgPackSerializer.hpp>
+#include <ArduinoJson/Struct/StructSerializer.hpp>
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// Passed to jsonFields() to count the fields, since MessagePack needs the size
+// of the map upfront. The count doesn't depend on the values, so the compiler
+// can usually fold this pass into a constant.
+class FieldCounter {
+ public:
+  FieldCounter() : _count(0) {}
+
+  template <size_t N, typename T>
+  void operator()(const char (&)[N], T &) {
+    _count++;
+  }
+
+  size_t count() const {
+    return _count;
+  }
+
+ private:
+  size_t _count;
+};
+
+template <typename TWriter>
+class MsgPackStructFormat : private MsgPackSerializer<TWriter> {
+  typedef MsgPackSerializer<TWriter> base;
+
+ protected:
+  MsgPackStructFormat(TWriter writer) : base(writer) {}
+
+  base &visitor() {
+    return *this;
+  }
+
+  size_t bytesWritten() const {
+    return base::bytesWritten();
+  }
+
+  template <typename T>
+  void beginObject(T &fields) {
+    FieldCounter counter;
+    jsonFields(fields, counter);
+    base::writeMapHeader(counter.count());
+  }
+
+  void endObject() {}
+
+  void beginArray(size_t size) {
+    base::writeArrayHeader(size);
+  }
+
+  void endArray() {}
+
+  void writeSeparator() {}
+
+  // The length is known at compile time, so is the header
+  template <size_t N>
+  void writeKey(const char (&name)[N]) {
+    base::visitString(name, N - 1);
+  }
+};
+
+template <typename TWriter>
+class MsgPackStructSerializer
+    : public StructSerializer<MsgPackStructFormat<TWriter> > {
+ public:
+  static const bool producesText = false;
+
+  MsgPackStructSerializer(TWriter writer)
+      : StructSerializer<MsgPackStructFormat<TWriter> >(writer) {}
+};
+
+// Serializes a struct declared with jsonFields() (see deserializeJsonStruct())
+// to MessagePack, without a JsonDocument.
+
+template <typename T, typename TDestination>
+size_t serializeMsgPackStruct(const T &source, TDestination &destination) {
+  return serializeStruct<MsgPackStructSerializer>(source, destination);
+}
+
+template <typename T>
+size_t serializeMsgPackStruct(const T &source, void *buffer,
+                              size_t bufferSize) {
+  return serializeStruct<MsgPackStructSerializer>(source, buffer, bufferSize);
+}
+
+template <typename T>
+size_t measureMsgPackStruct(const T &source) {
+  return measureStruct<MsgPackStructSerializer>(source);
+}
+
+}  // namespace ARDUINOJSON_NAMESPACE
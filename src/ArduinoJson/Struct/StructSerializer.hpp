@@ -0,0 +1,160 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Numbers/Integer.hpp>
+#include <ArduinoJson/Polyfills/type_traits.hpp>
+#include <ArduinoJson/Serialization/measure.hpp>
+#include <ArduinoJson/Serialization/serialize.hpp>
+#include <ArduinoJson/Serialization/writeValue.hpp>
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// Passed to jsonFields() to write each field
+template <typename TSerializer>
+class FieldWriter {
+ public:
+  FieldWriter(TSerializer *serializer) : _serializer(serializer), _count(0) {}
+
+  template <size_t N, typename T>
+  void operator()(const char (&name)[N], T &value) {
+    _serializer->writeMember(name, value, _count++ == 0);
+  }
+
+ private:
+  TSerializer *_serializer;
+  size_t _count;
+};
+
+// Makes a struct declared with jsonFields() look like a variant to serialize()
+// and measure(), so that the struct serializers share the writers and the
+// buffering of serializeJson() and serializeMsgPack().
+template <typename T>
+class VisitableStruct {
+ public:
+  explicit VisitableStruct(const T &value) : _value(&value) {}
+
+  template <typename TSerializer>
+  typename TSerializer::result_type accept(TSerializer &serializer) const {
+    return serializer.visitStruct(*_value);
+  }
+
+ private:
+  const T *_value;
+};
+
+// Writes the fields of a struct declared with jsonFields(), without a
+// JsonDocument. TFormat writes the containers and the keys; the values go to
+// its visitor(), a JsonSerializer or a MsgPackSerializer.
+template <typename TFormat>
+class StructSerializer : private TFormat {
+ public:
+  typedef size_t result_type;
+
+  template <typename TWriter>
+  explicit StructSerializer(TWriter writer) : TFormat(writer) {}
+
+  template <typename T>
+  size_t visitStruct(const T &src) {
+    writeField(src);
+    return TFormat::bytesWritten();
+  }
+
+ private:
+  friend class FieldWriter<StructSerializer>;
+
+  template <size_t N, typename T>
+  void writeMember(const char (&name)[N], const T &value, bool first) {
+    if (!first)
+      TFormat::writeSeparator();
+    TFormat::writeKey(name);
+    writeField(value);
+  }
+
+  // Nested struct
+  template <typename T>
+  typename enable_if<is_class<T>::value>::type writeField(const T &src) {
+    // jsonFields() takes a non-const reference, but the fields are only read
+    T &fields = const_cast<T &>(src);
+    TFormat::beginObject(fields);
+    FieldWriter<StructSerializer> writer(this);
+    jsonFields(fields, writer);  // Error here? Declare jsonFields() for T
+    TFormat::endObject();
+  }
+
+  // Fixed-size array
+  template <typename T, size_t N>
+  void writeField(const T (&src)[N]) {
+    TFormat::beginArray(N);
+    for (size_t i = 0; i < N; i++) {
+      if (i > 0)
+        TFormat::writeSeparator();
+      writeField(src[i]);
+    }
+    TFormat::endArray();
+  }
+
+  // Char array: the string stops at the terminator, or at the end of the array
+  template <size_t N>
+  void writeField(const char (&src)[N]) {
+    size_t n = 0;
+    while (n < N && src[n])
+      n++;
+    TFormat::visitor().visitString(src, n);
+  }
+
+#if ARDUINOJSON_ENABLE_STD_STRING
+  void writeField(const std::string &src) {
+    writeValue(TFormat::visitor(), src);
+  }
+#endif
+
+#if ARDUINOJSON_ENABLE_ARDUINO_STRING
+  void writeField(const ::String &src) {
+    writeValue(TFormat::visitor(), src);
+  }
+#endif
+
+  void writeField(bool src) {
+    writeValue(TFormat::visitor(), src);
+  }
+
+  template <typename T>
+  typename enable_if<is_integral<T>::value && !is_same<bool, T>::value &&
+                     !is_same<char, T>::value>::type
+  writeField(T src) {
+    ARDUINOJSON_ASSERT_INTEGER_TYPE_IS_SUPPORTED(T);
+    writeValue(TFormat::visitor(), src);
+  }
+
+  template <typename T>
+  typename enable_if<is_enum<T>::value>::type writeField(T src) {
+    TFormat::visitor().visitSignedInteger(static_cast<Integer>(src));
+  }
+
+  template <typename T>
+  typename enable_if<is_floating_point<T>::value>::type writeField(T src) {
+    writeValue(TFormat::visitor(), src);
+  }
+};
+
+template <template <typename> class TSerializer, typename T,
+          typename TDestination>
+size_t serializeStruct(const T &source, TDestination &destination) {
+  return serialize<TSerializer>(VisitableStruct<T>(source), destination);
+}
+
+template <template <typename> class TSerializer, typename T>
+size_t serializeStruct(const T &source, void *buffer, size_t bufferSize) {
+  return serialize<TSerializer>(VisitableStruct<T>(source), buffer,
+                                bufferSize);
+}
+
+template <template <typename> class TSerializer, typename T>
+size_t measureStruct(const T &source) {
+  return measure<TSerializer>(VisitableStruct<T>(source));
+}
+
+}  // namespace ARDUINOJSON_NAMESPACE
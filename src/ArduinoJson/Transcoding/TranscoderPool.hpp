@@ -0,0 +1,21 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Memory/MemoryPool.hpp>
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// The transcoders reuse the deserializers, which need a MemoryPool.
+// This one is empty since the transcoders never allocate anything.
+// It's a base class so that it's constructed before the deserializer.
+class TranscoderPool {
+ protected:
+  TranscoderPool() : _pool(0, 0) {}
+
+  MemoryPool _pool;
+};
+
+}  // namespace ARDUINOJSON_NAMESPACE
@@ -0,0 +1,307 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Json/JsonDeserializer.hpp>
+#include <ArduinoJson/MsgPack/MsgPackSerializer.hpp>
+#include <ArduinoJson/Transcoding/TranscoderPool.hpp>
+
+#if ARDUINOJSON_ENABLE_STD_STRING
+
+#  include <string>
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// Replaces the StringCopier: the characters of the strings go straight to the
+// MessagePack output
+class MsgPackStringAppender {
+ public:
+  MsgPackStringAppender(std::string &output) : _output(&output) {}
+
+  void startString() {}
+
+  void append(char c) {
+    *_output += c;
+  }
+
+  bool isValid() const {
+    return true;
+  }
+
+ private:
+  std::string *_output;
+};
+
+// Converts JSON to MessagePack without storing anything in a JsonDocument.
+//
+// MessagePack puts the size of strings, arrays, and objects before their
+// content, so the transcoder reserves one byte for the header (enough for
+// fixstr, fixarray, and fixmap) and patches it once the content is written.
+// Only the bigger headers require moving the content.
+template <typename TReader>
+class JsonToMsgPackTranscoder
+    : private TranscoderPool,
+      private JsonDeserializer<TReader, MsgPackStringAppender> {
+  typedef JsonDeserializer<TReader, MsgPackStringAppender> base;
+  typedef MsgPackSerializer<StaticStringWriter> HeaderWriter;
+
+ public:
+  JsonToMsgPackTranscoder(TReader reader, std::string &output)
+      : base(_pool, reader, MsgPackStringAppender(output)),
+        _output(&output),
+        _serializer(Writer<std::string>(output)) {}
+
+  // On error, the output is restored to its original size, so the caller
+  // never sees a partial document
+  DeserializationError transcode(NestingLimit nestingLimit) {
+    size_t initialSize = _output->size();
+    DeserializationError err = transcodeRoot(nestingLimit);
+    if (err)
+      _output->resize(initialSize);
+    return err;
+  }
+
+ private:
+  DeserializationError transcodeRoot(NestingLimit nestingLimit) {
+    if (!base::skipSpacesAndComments())
+      return base::_error;
+
+    char first = base::current();
+
+    if (!transcodeVariant(nestingLimit))
+      return base::_error;
+
+    bool isEnclosed = first == '[' || first == '{' || base::isQuote(first);
+    if (base::_latch.last() != 0 && !isEnclosed) {
+      // We don't detect trailing characters earlier, so we need to check now
+      return DeserializationError::InvalidInput;
+    }
+
+    return DeserializationError::Ok;
+  }
+
+  bool transcodeVariant(NestingLimit nestingLimit) {
+    if (!base::skipSpacesAndComments())
+      return false;
+
+    switch (base::current()) {
+      case '[':
+        return transcodeArray(nestingLimit);
+
+      case '{':
+        return transcodeObject(nestingLimit);
+
+      case '\"':
+      case '\'':
+        return transcodeString(false);
+
+      default:
+        return transcodeNumericValue();
+    }
+  }
+
+  bool transcodeArray(NestingLimit nestingLimit) {
+    if (nestingLimit.reached()) {
+      base::_error = DeserializationError::TooDeep;
+      return false;
+    }
+
+    // Skip opening braket
+    ARDUINOJSON_ASSERT(base::current() == '[');
+    base::move();
+
+    size_t header = reserveHeader();
+    size_t count = 0;
+
+    // Skip spaces
+    if (!base::skipSpacesAndComments())
+      return false;
+
+    // Empty array?
+    if (!base::eat(']')) {
+      // Read each value
+      for (;;) {
+        // 1 - Transcode value
+        if (!transcodeVariant(nestingLimit.decrement()))
+          return false;
+        count++;
+
+        // 2 - Skip spaces
+        if (!base::skipSpacesAndComments())
+          return false;
+
+        // 3 - More values?
+        if (base::eat(']'))
+          break;
+        if (!base::eat(',')) {
+          base::_error = DeserializationError::InvalidInput;
+          return false;
+        }
+      }
+    }
+
+    patchHeader(header, &HeaderWriter::writeArrayHeader, count);
+    return true;
+  }
+
+  bool transcodeObject(NestingLimit nestingLimit) {
+    if (nestingLimit.reached()) {
+      base::_error = DeserializationError::TooDeep;
+      return false;
+    }
+
+    // Skip opening brace
+    ARDUINOJSON_ASSERT(base::current() == '{');
+    base::move();
+
+    size_t header = reserveHeader();
+    size_t count = 0;
+
+    // Skip spaces
+    if (!base::skipSpacesAndComments())
+      return false;
+
+    // Empty object?
+    if (!base::eat('}')) {
+      // Read each key value pair
+      for (;;) {
+        // Transcode key
+        if (!transcodeString(true))
+          return false;
+
+        // Skip spaces
+        if (!base::skipSpacesAndComments())
+          return false;
+
+        // Colon
+        if (!base::eat(':')) {
+          base::_error = DeserializationError::InvalidInput;
+          return false;
+        }
+
+        // Transcode value
+        if (!transcodeVariant(nestingLimit.decrement()))
+          return false;
+        count++;
+
+        // Skip spaces
+        if (!base::skipSpacesAndComments())
+          return false;
+
+        // More keys/values?
+        if (base::eat('}'))
+          break;
+        if (!base::eat(',')) {
+          base::_error = DeserializationError::InvalidInput;
+          return false;
+        }
+
+        // Skip spaces
+        if (!base::skipSpacesAndComments())
+          return false;
+      }
+    }
+
+    patchHeader(header, &HeaderWriter::writeMapHeader, count);
+    return true;
+  }
+
+  bool transcodeString(bool isKey) {
+    size_t header = reserveHeader();
+
+    // keys can be unquoted, like in deserializeJson()
+    if (!(isKey ? base::parseKey() : base::parseQuotedString()))
+      return false;
+
+    patchHeader(header, &HeaderWriter::writeStringHeader,
+                _output->size() - header - 1);
+    return true;
+  }
+
+  bool transcodeNumericValue() {
+    VariantData value;
+    value.init();  // VariantData is a POD, so it has no constructor
+    if (!base::parseNumericValue(value))
+      return false;
+    value.accept(_serializer);
+    return true;
+  }
+
+  size_t reserveHeader() {
+    size_t position = _output->size();
+    *_output += '\0';
+    return position;
+  }
+
+  void patchHeader(size_t position, size_t (HeaderWriter::*writeHeader)(size_t),
+                   size_t size) {
+    char header[5];
+    HeaderWriter writer(StaticStringWriter(header, sizeof(header)));
+    size_t n = (writer.*writeHeader)(size);
+    if (n == 1)
+      (*_output)[position] = header[0];
+    else
+      _output->replace(position, 1, header, n);
+  }
+
+  std::string *_output;
+  MsgPackSerializer<Writer<std::string> > _serializer;
+};
+
+// Converts JSON to MessagePack without the intermediate JsonDocument.
+// The output is appended to the string.
+// Unlike deserializeJson(), duplicate keys are kept.
+
+//
+// transcodeJsonToMsgPack(const std::string&, std::string&, ...)
+//
+template <typename TString>
+typename enable_if<!is_array<TString>::value, DeserializationError>::type
+transcodeJsonToMsgPack(const TString &input, std::string &output,
+                       NestingLimit nestingLimit = NestingLimit()) {
+  Reader<TString> reader(input);
+  return JsonToMsgPackTranscoder<Reader<TString> >(reader, output)
+      .transcode(nestingLimit);
+}
+
+//
+// transcodeJsonToMsgPack(std::istream&, std::string&, ...)
+//
+template <typename TStream>
+DeserializationError transcodeJsonToMsgPack(
+    TStream &input, std::string &output,
+    NestingLimit nestingLimit = NestingLimit()) {
+  Reader<TStream> reader(input);
+  return JsonToMsgPackTranscoder<Reader<TStream> >(reader, output)
+      .transcode(nestingLimit);
+}
+
+//
+// transcodeJsonToMsgPack(char*, std::string&, ...)
+//
+template <typename TChar>
+DeserializationError transcodeJsonToMsgPack(
+    TChar *input, std::string &output,
+    NestingLimit nestingLimit = NestingLimit()) {
+  Reader<TChar *> reader(input);
+  return JsonToMsgPackTranscoder<Reader<TChar *> >(reader, output)
+      .transcode(nestingLimit);
+}
+
+//
+// transcodeJsonToMsgPack(char*, size_t, std::string&, ...)
+//
+template <typename TChar>
+DeserializationError transcodeJsonToMsgPack(
+    TChar *input, size_t inputSize, std::string &output,
+    NestingLimit nestingLimit = NestingLimit()) {
+  BoundedReader<TChar *> reader(input, inputSize);
+  return JsonToMsgPackTranscoder<BoundedReader<TChar *> >(reader, output)
+      .transcode(nestingLimit);
+}
+
+}  // namespace ARDUINOJSON_NAMESPACE
+
+#endif
@@ -0,0 +1,411 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Json/JsonSerializer.hpp>
+#include <ArduinoJson/Json/TextFormatter.hpp>
+#include <ArduinoJson/MsgPack/MsgPackDeserializer.hpp>
+#include <ArduinoJson/Serialization/Writer.hpp>
+#include <ArduinoJson/StringStorage/StringCopier.hpp>
+#include <ArduinoJson/Transcoding/TranscoderPool.hpp>
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// Converts MessagePack to JSON without storing anything in a JsonDocument.
+// Strings and binaries are copied by small chunks, so the memory usage doesn't
+// depend on the input.
+template <typename TReader, typename TWriter>
+class MsgPackToJsonTranscoder
+    : private TranscoderPool,
+      private MsgPackDeserializer<TReader, StringCopier> {
+  typedef MsgPackDeserializer<TReader, StringCopier> base;
+
+ public:
+  MsgPackToJsonTranscoder(TReader reader, TWriter writer)
+      : base(_pool, reader, StringCopier(_pool)),
+        _writer(writer),
+        _formatter(writer) {}
+
+  DeserializationError transcode(NestingLimit nestingLimit) {
+    transcodeVariant(nestingLimit);
+    return base::_foundSomething ? base::_error
+                                 : DeserializationError::EmptyInput;
+  }
+
+ private:
+  bool transcodeVariant(NestingLimit nestingLimit) {
+    uint8_t code = 0;
+    if (!base::readByte(code))
+      return false;
+
+    base::_foundSomething = true;
+
+    VariantData value;
+    value.init();  // VariantData is a POD, so it has no constructor
+
+    switch (code) {
+      case 0xc0:
+        break;
+
+      case 0xc1:
+        return base::invalidInput();
+
+      case 0xc2:
+        value.setBoolean(false);
+        break;
+
+      case 0xc3:
+        value.setBoolean(true);
+        break;
+
+      case 0xc4:  // bin 8
+        return transcodeBinary<uint8_t>();
+
+      case 0xc5:  // bin 16
+        return transcodeBinary<uint16_t>();
+
+      case 0xc6:  // bin 32
+        return transcodeBinary<uint32_t>();
+
+      case 0xc7:  // ext 8
+        return transcodeExtension<uint8_t>();
+
+      case 0xc8:  // ext 16
+        return transcodeExtension<uint16_t>();
+
+      case 0xc9:  // ext 32
+        return transcodeExtension<uint32_t>();
+
+      case 0xca:
+        if (!this->template readFloat<float>(&value))
+          return false;
+        break;
+
+      case 0xcb:
+        if (!this->template readDouble<double>(&value))
+          return false;
+        break;
+
+      case 0xcc:
+        if (!this->template readInteger<uint8_t>(&value))
+          return false;
+        break;
+
+      case 0xcd:
+        if (!this->template readInteger<uint16_t>(&value))
+          return false;
+        break;
+
+      case 0xce:
+        if (!this->template readInteger<uint32_t>(&value))
+          return false;
+        break;
+
+      case 0xcf:
+#if ARDUINOJSON_USE_LONG_LONG
+        if (!this->template readInteger<uint64_t>(&value))
+          return false;
+#else
+        if (!base::skipBytes(8))  // not supported
+          return false;
+#endif
+        break;
+
+      case 0xd0:
+        if (!this->template readInteger<int8_t>(&value))
+          return false;
+        break;
+
+      case 0xd1:
+        if (!this->template readInteger<int16_t>(&value))
+          return false;
+        break;
+
+      case 0xd2:
+        if (!this->template readInteger<int32_t>(&value))
+          return false;
+        break;
+
+      case 0xd3:
+#if ARDUINOJSON_USE_LONG_LONG
+        if (!this->template readInteger<int64_t>(&value))
+          return false;
+#else
+        if (!base::skipBytes(8))  // not supported
+          return false;
+#endif
+        break;
+
+      case 0xd4:  // fixext 1
+        return transcodeExtension(1);
+
+      case 0xd5:  // fixext 2
+        return transcodeExtension(2);
+
+      case 0xd6:  // fixext 4
+        return transcodeExtension(4);
+
+      case 0xd7:  // fixext 8
+        return transcodeExtension(8);
+
+      case 0xd8:  // fixext 16
+        return transcodeExtension(16);
+
+      case 0xd9:
+        return transcodeString<uint8_t>();
+
+      case 0xda:
+        return transcodeString<uint16_t>();
+
+      case 0xdb:
+        return transcodeString<uint32_t>();
+
+      case 0xdc:
+        return transcodeArray<uint16_t>(nestingLimit);
+
+      case 0xdd:
+        return transcodeArray<uint32_t>(nestingLimit);
+
+      case 0xde:
+        return transcodeObject<uint16_t>(nestingLimit);
+
+      case 0xdf:
+        return transcodeObject<uint32_t>(nestingLimit);
+
+      default:
+        switch (code & 0xf0) {
+          case 0x80:
+            return transcodeObject(code & 0x0F, nestingLimit);
+
+          case 0x90:
+            return transcodeArray(code & 0x0F, nestingLimit);
+        }
+
+        if ((code & 0xe0) == 0xa0)
+          return transcodeString(code & 0x1f);
+
+        value.setInteger(static_cast<int8_t>(code));
+    }
+
+    JsonSerializer<TWriter> serializer(_writer);
+    value.accept(serializer);
+    return true;
+  }
+
+  template <typename TSize>
+  bool transcodeArray(NestingLimit nestingLimit) {
+    TSize size;
+    if (!base::readInteger(size))
+      return false;
+    return transcodeArray(size, nestingLimit);
+  }
+
+  bool transcodeArray(size_t n, NestingLimit nestingLimit) {
+    if (nestingLimit.reached()) {
+      base::_error = DeserializationError::TooDeep;
+      return false;
+    }
+
+    _formatter.writeRaw('[');
+    for (size_t i = 0; i < n; i++) {
+      if (i > 0)
+        _formatter.writeRaw(',');
+      if (!transcodeVariant(nestingLimit.decrement()))
+        return false;
+    }
+    _formatter.writeRaw(']');
+    return true;
+  }
+
+  template <typename TSize>
+  bool transcodeObject(NestingLimit nestingLimit) {
+    TSize size;
+    if (!base::readInteger(size))
+      return false;
+    return transcodeObject(size, nestingLimit);
+  }
+
+  bool transcodeObject(size_t n, NestingLimit nestingLimit) {
+    if (nestingLimit.reached()) {
+      base::_error = DeserializationError::TooDeep;
+      return false;
+    }
+
+    _formatter.writeRaw('{');
+    for (size_t i = 0; i < n; i++) {
+      if (i > 0)
+        _formatter.writeRaw(',');
+      if (!transcodeKey())
+        return false;
+      _formatter.writeRaw(':');
+      if (!transcodeVariant(nestingLimit.decrement()))
+        return false;
+    }
+    _formatter.writeRaw('}');
+    return true;
+  }
+
+  bool transcodeKey() {
+    uint8_t code;
+    if (!base::readByte(code))
+      return false;
+
+    if ((code & 0xe0) == 0xa0)
+      return transcodeString(code & 0x1f);
+
+    switch (code) {
+      case 0xd9:
+        return transcodeString<uint8_t>();
+
+      case 0xda:
+        return transcodeString<uint16_t>();
+
+      case 0xdb:
+        return transcodeString<uint32_t>();
+
+      default:
+        return base::invalidInput();
+    }
+  }
+
+  template <typename TSize>
+  bool transcodeString() {
+    TSize size;
+    if (!base::readInteger(size))
+      return false;
+    return transcodeString(size);
+  }
+
+  bool transcodeString(size_t n) {
+    _formatter.writeRaw('\"');
+    while (n > 0) {
+      size_t size = n < sizeof(_chunk) ? n : sizeof(_chunk);
+      if (!base::readBytes(_chunk, size))
+        return false;
+      for (size_t i = 0; i < size; i++)
+        _formatter.writeChar(static_cast<char>(_chunk[i]));
+      n -= size;
+    }
+    _formatter.writeRaw('\"');
+    return true;
+  }
+
+  template <typename TSize>
+  bool transcodeBinary() {
+    TSize size;
+    if (!base::readInteger(size))
+      return false;
+    return transcodeBinary(size);
+  }
+
+  bool transcodeBinary(size_t n) {
+    _formatter.writeRaw('\"');
+    while (n > 0) {
+      size_t size = n < sizeof(_chunk) ? n : sizeof(_chunk);
+      if (!base::readBytes(_chunk, size))
+        return false;
+      _formatter.writeBinaryChars(_chunk, size);
+      n -= size;
+    }
+    _formatter.writeRaw('\"');
+    return true;
+  }
+
+  template <typename TSize>
+  bool transcodeExtension() {
+    TSize size;
+    if (!base::readInteger(size))
+      return false;
+    return transcodeExtension(size);
+  }
+
+  // The type code is lost, like in serializeJson()
+  bool transcodeExtension(size_t n) {
+    if (!base::skipBytes(1))
+      return false;
+    return transcodeBinary(n);
+  }
+
+  TWriter _writer;
+  TextFormatter<TWriter> _formatter;
+  uint8_t _chunk[48];  // a multiple of 3, see writeBinaryChars()
+};
+
+template <typename TReader, typename TDestination>
+typename enable_if<!ShouldBufferWrites<TDestination>::value,
+                   DeserializationError>::type
+doTranscodeMsgPackToJson(TReader reader, TDestination &output,
+                         NestingLimit nestingLimit) {
+  typedef Writer<TDestination> TWriter;
+  return MsgPackToJsonTranscoder<TReader, TWriter>(reader, TWriter(output))
+      .transcode(nestingLimit);
+}
+
+// Streams get the same buffer as serializeJson(), see BufferingDecorator
+template <typename TReader, typename TDestination>
+typename enable_if<ShouldBufferWrites<TDestination>::value,
+                   DeserializationError>::type
+doTranscodeMsgPackToJson(TReader reader, TDestination &output,
+                         NestingLimit nestingLimit) {
+  typedef BufferingDecorator<Writer<TDestination> > TBuffer;
+  Writer<TDestination> writer(output);
+  TBuffer buffer(writer);
+  DeserializationError err =
+      MsgPackToJsonTranscoder<TReader, Writer<TBuffer> >(
+          reader, Writer<TBuffer>(buffer))
+          .transcode(nestingLimit);
+  buffer.flush();
+  return err;
+}
+
+// Converts MessagePack to JSON without the intermediate JsonDocument.
+// The output is written as the input is read, so it's truncated in case of
+// error.
+
+//
+// transcodeMsgPackToJson(const std::string&, TDestination&, ...)
+//
+template <typename TString, typename TDestination>
+typename enable_if<!is_array<TString>::value, DeserializationError>::type
+transcodeMsgPackToJson(const TString &input, TDestination &output,
+                       NestingLimit nestingLimit = NestingLimit()) {
+  return doTranscodeMsgPackToJson(Reader<TString>(input), output,
+                                  nestingLimit);
+}
+
+//
+// transcodeMsgPackToJson(std::istream&, TDestination&, ...)
+//
+template <typename TStream, typename TDestination>
+DeserializationError transcodeMsgPackToJson(
+    TStream &input, TDestination &output,
+    NestingLimit nestingLimit = NestingLimit()) {
+  return doTranscodeMsgPackToJson(Reader<TStream>(input), output,
+                                  nestingLimit);
+}
+
+//
+// transcodeMsgPackToJson(char*, TDestination&, ...)
+//
+template <typename TChar, typename TDestination>
+DeserializationError transcodeMsgPackToJson(
+    TChar *input, TDestination &output,
+    NestingLimit nestingLimit = NestingLimit()) {
+  return doTranscodeMsgPackToJson(Reader<TChar *>(input), output,
+                                  nestingLimit);
+}
+
+//
+// transcodeMsgPackToJson(char*, size_t, TDestination&, ...)
+//
+template <typename TChar, typename TDestination>
+DeserializationError transcodeMsgPackToJson(
+    TChar *input, size_t inputSize, TDestination &output,
+    NestingLimit nestingLimit = NestingLimit()) {
+  return doTranscodeMsgPackToJson(BoundedReader<TChar *>(input, inputSize),
+                                  output, nestingLimit);
+}
+
+}  // namespace ARDUINOJSON_NAMESPACE
@@ -128,6 +128,49 @@ struct RawComparer : ComparerBase {
   }
 };
 
+inline CompareResult compareBytes(const uint8_t *lhsData, size_t lhsSize,
+                                  const uint8_t *rhsData, size_t rhsSize) {
+  size_t size = rhsSize < lhsSize ? rhsSize : lhsSize;
+  int n = size ? memcmp(lhsData, rhsData, size) : 0;
+  if (n < 0 || (n == 0 && lhsSize < rhsSize))
+    return COMPARE_RESULT_LESS;
+  else if (n > 0 || (n == 0 && lhsSize > rhsSize))
+    return COMPARE_RESULT_GREATER;
+  else
+    return COMPARE_RESULT_EQUAL;
+}
+
+struct BinaryComparer : ComparerBase {
+  const uint8_t *_rhsData;
+  size_t _rhsSize;
+
+  explicit BinaryComparer(const uint8_t *rhsData, size_t rhsSize)
+      : _rhsData(rhsData), _rhsSize(rhsSize) {}
+
+  CompareResult visitBinary(const uint8_t *lhsData, size_t lhsSize) {
+    return compareBytes(lhsData, lhsSize, _rhsData, _rhsSize);
+  }
+};
+
+struct ExtensionComparer : ComparerBase {
+  int8_t _rhsType;
+  const uint8_t *_rhsData;
+  size_t _rhsSize;
+
+  explicit ExtensionComparer(int8_t rhsType, const uint8_t *rhsData,
+                             size_t rhsSize)
+      : _rhsType(rhsType), _rhsData(rhsData), _rhsSize(rhsSize) {}
+
+  CompareResult visitExtension(int8_t lhsType, const uint8_t *lhsData,
+                               size_t lhsSize) {
+    if (lhsType < _rhsType)
+      return COMPARE_RESULT_LESS;
+    if (lhsType > _rhsType)
+      return COMPARE_RESULT_GREATER;
+    return compareBytes(lhsData, lhsSize, _rhsData, _rhsSize);
+  }
+};
+
 template <typename T>
 struct Comparer<T, typename enable_if<IsVisitable<T>::value>::type>
     : ComparerBase {
@@ -160,6 +203,17 @@ struct Comparer<T, typename enable_if<IsVisitable<T>::value>::type>
     return accept(comparer);
   }
 
+  CompareResult visitBinary(const uint8_t *lhsData, size_t lhsSize) {
+    BinaryComparer comparer(lhsData, lhsSize);
+    return accept(comparer);
+  }
+
+  CompareResult visitExtension(int8_t lhsType, const uint8_t *lhsData,
+                               size_t lhsSize) {
+    ExtensionComparer comparer(lhsType, lhsData, lhsSize);
+    return accept(comparer);
+  }
+
   CompareResult visitSignedInteger(Integer lhs) {
     Comparer<Integer> comparer(lhs);
     return accept(comparer);
@@ -21,6 +21,10 @@ enum {
   VALUE_IS_OWNED_RAW = 0x03,
   VALUE_IS_LINKED_STRING = 0x04,
   VALUE_IS_OWNED_STRING = 0x05,
+  VALUE_IS_LINKED_BINARY = 0x12,
+  VALUE_IS_OWNED_BINARY = 0x13,
+  VALUE_IS_LINKED_EXTENSION = 0x14,  // the type code precedes the data
+  VALUE_IS_OWNED_EXTENSION = 0x15,
 
   // CAUTION: no OWNED_VALUE_BIT below
 
@@ -55,6 +59,10 @@ union VariantContent {
   struct {
     const char *data;
     size_t size;
-  } asString;
+  } asString;  // linked strings, raw values, and binaries
+  struct {
+    ptrdiff_t offset;  // relative to the variant, see RelativePointer.hpp
+    size_t size;
+  } asOwnedString;  // owned strings, raw values, and binaries
 };
 }  // namespace ARDUINOJSON_NAMESPACE
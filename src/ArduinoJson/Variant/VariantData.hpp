@@ -11,6 +11,8 @@
 #include <ArduinoJson/Strings/StringAdapters.hpp>
 #include <ArduinoJson/Variant/VariantContent.hpp>
 
+#include <string.h>  // memcpy, memset
+
 // VariantData can't have a constructor (to be a POD), so we have no way to fix
 // this warning
 #if defined(__GNUC__)
@@ -51,13 +53,20 @@ class VariantData {
 
       case VALUE_IS_LINKED_STRING:
       case VALUE_IS_OWNED_STRING:
-        return visitor.visitString(_content.asString.data,
-                                   _content.asString.size);
+        return visitor.visitString(stringData(), stringSize());
 
       case VALUE_IS_OWNED_RAW:
       case VALUE_IS_LINKED_RAW:
-        return visitor.visitRawJson(_content.asString.data,
-                                    _content.asString.size);
+        return visitor.visitRawJson(stringData(), stringSize());
+
+      case VALUE_IS_LINKED_BINARY:
+      case VALUE_IS_OWNED_BINARY:
+        return visitor.visitBinary(binaryData(), stringSize());
+
+      case VALUE_IS_LINKED_EXTENSION:
+      case VALUE_IS_OWNED_EXTENSION:
+        return visitor.visitExtension(static_cast<int8_t>(binaryData()[0]),
+                                      binaryData() + 1, stringSize() - 1);
 
       case VALUE_IS_SIGNED_INTEGER:
         return visitor.visitSignedInteger(_content.asSignedInteger);
@@ -81,6 +90,10 @@ class VariantData {
 
   String asString() const;
 
+  // Returns the bytes of a binary or an extension.
+  // For extensions, the first byte is the type code.
+  String asBinary() const;
+
   bool asBoolean() const;
 
   const VariantData *resolve() const {
@@ -149,6 +162,15 @@ class VariantData {
     return type() == VALUE_IS_LINKED_STRING || type() == VALUE_IS_OWNED_STRING;
   }
 
+  bool isBinary() const {
+    return type() == VALUE_IS_LINKED_BINARY || type() == VALUE_IS_OWNED_BINARY;
+  }
+
+  bool isExtension() const {
+    return type() == VALUE_IS_LINKED_EXTENSION ||
+           type() == VALUE_IS_OWNED_EXTENSION;
+  }
+
   bool isObject() const {
     return (_flags & VALUE_IS_OBJECT) != 0;
   }
@@ -197,8 +219,8 @@ class VariantData {
     const char *dup = pool->saveString(adaptString(value.data(), value.size()));
     if (dup) {
       setType(VALUE_IS_OWNED_RAW);
-      _content.asString.data = dup;
-      _content.asString.size = value.size();
+      _content.asOwnedString.offset = makeRelative(this, dup);
+      _content.asOwnedString.size = value.size();
       return true;
     } else {
       setType(VALUE_IS_NULL);
@@ -222,6 +244,43 @@ class VariantData {
     setType(VALUE_IS_NULL);
   }
 
+  // Same as operator=, except that the bytes that the value doesn't use are
+  // zeroed instead of being copied, see serializeImage().
+  // Like operator=, it copies the relative references as they are.
+  void assignZeroPadded(const VariantData &src) {
+    memset(this, 0, sizeof(*this));
+    _flags = src._flags;
+    switch (src.type()) {
+      case VALUE_IS_NULL:
+        break;
+      case VALUE_IS_BOOLEAN:
+        _content.asBoolean = src._content.asBoolean;
+        break;
+      case VALUE_IS_UNSIGNED_INTEGER:
+        _content.asUnsignedInteger = src._content.asUnsignedInteger;
+        break;
+      case VALUE_IS_SIGNED_INTEGER:
+        _content.asSignedInteger = src._content.asSignedInteger;
+        break;
+      case VALUE_IS_FLOAT:
+        _content.asFloat = src._content.asFloat;
+        break;
+      case VALUE_IS_ARRAY:
+      case VALUE_IS_OBJECT:
+        _content.asCollection = src._content.asCollection;
+        break;
+      case VALUE_IS_POINTER:
+        _content.asPointer = src._content.asPointer;
+        break;
+      default:
+        if (src._flags & OWNED_VALUE_BIT)
+          _content.asOwnedString = src._content.asOwnedString;
+        else
+          _content.asString = src._content.asString;
+        break;
+    }
+  }
+
   void setPointer(const VariantData *p) {
     ARDUINOJSON_ASSERT(p);
     setType(VALUE_IS_POINTER);
@@ -230,12 +289,34 @@ class VariantData {
 
   void setString(String s) {
     ARDUINOJSON_ASSERT(s);
-    if (s.isLinked())
+    if (s.isLinked()) {
       setType(VALUE_IS_LINKED_STRING);
-    else
+      _content.asString.data = s.c_str();
+      _content.asString.size = s.size();
+    } else {
       setType(VALUE_IS_OWNED_STRING);
-    _content.asString.data = s.c_str();
-    _content.asString.size = s.size();
+      _content.asOwnedString.offset = makeRelative(this, s.c_str());
+      _content.asOwnedString.size = s.size();
+    }
+  }
+
+  void setBinary(String s) {
+    setBytes(s, VALUE_IS_LINKED_BINARY);
+  }
+
+  // The first byte of s is the type code
+  void setExtension(String s) {
+    setBytes(s, VALUE_IS_LINKED_EXTENSION);
+  }
+
+  bool storeBinary(const void *data, size_t size, MemoryPool *pool) {
+    return storeBytes(0, data, size, VALUE_IS_LINKED_BINARY, pool);
+  }
+
+  bool storeExtension(int8_t type, const void *data, size_t size,
+                      MemoryPool *pool) {
+    char typeCode = static_cast<char>(type);
+    return storeBytes(&typeCode, data, size, VALUE_IS_LINKED_EXTENSION, pool);
   }
 
   CollectionData &toArray() {
@@ -254,9 +335,11 @@ class VariantData {
     switch (type()) {
       case VALUE_IS_OWNED_STRING:
       case VALUE_IS_OWNED_RAW:
+      case VALUE_IS_OWNED_BINARY:
+      case VALUE_IS_OWNED_EXTENSION:
         // We always add a zero at the end: the deduplication function uses it
         // to detect the beginning of the next string.
-        return _content.asString.size + 1;
+        return _content.asOwnedString.size + 1;
       case VALUE_IS_OBJECT:
       case VALUE_IS_ARRAY:
         return _content.asCollection.memoryUsage();
@@ -306,9 +389,13 @@ class VariantData {
     return _content.asCollection.getOrAddMember(key, pool, storage_policy);
   }
 
+  // Called when the strings moved by stringDistance and the variants moved by
+  // variantDistance, relative to this variant.
+  // Pass the same value twice when the variant itself moved: the references
+  // inside the memory pool are relative, so they don't need to be updated.
   void movePointers(ptrdiff_t stringDistance, ptrdiff_t variantDistance) {
     if (_flags & OWNED_VALUE_BIT)
-      _content.asString.data += stringDistance;
+      _content.asOwnedString.offset += stringDistance;
     if (_flags & COLLECTION_MASK)
       _content.asCollection.movePointers(stringDistance, variantDistance);
   }
@@ -329,6 +416,52 @@ class VariantData {
   }
 
  private:
+  const char *stringData() const {
+    if (_flags & OWNED_VALUE_BIT)
+      return resolveRelative<const char>(this, _content.asOwnedString.offset);
+    return _content.asString.data;
+  }
+
+  size_t stringSize() const {
+    if (_flags & OWNED_VALUE_BIT)
+      return _content.asOwnedString.size;
+    return _content.asString.size;
+  }
+
+  const uint8_t *binaryData() const {
+    return reinterpret_cast<const uint8_t *>(stringData());
+  }
+
+  void setBytes(String s, uint8_t linkedType) {
+    if (s.isLinked()) {
+      setType(linkedType);
+      _content.asString.data = s.c_str();
+      _content.asString.size = s.size();
+    } else {
+      setType(linkedType | OWNED_VALUE_BIT);
+      _content.asOwnedString.offset = makeRelative(this, s.c_str());
+      _content.asOwnedString.size = s.size();
+    }
+  }
+
+  // Copies the optional type code and the data to the pool
+  bool storeBytes(const char *typeCode, const void *data, size_t size,
+                  uint8_t linkedType, MemoryPool *pool) {
+    size_t prefixSize = typeCode ? 1 : 0;
+    char *copy = pool->allocStringZone(prefixSize + size + 1);
+    if (!copy) {
+      setNull();
+      return false;
+    }
+    if (typeCode)
+      copy[0] = *typeCode;
+    if (size)
+      memcpy(copy + prefixSize, data, size);
+    copy[prefixSize + size] = 0;  // see memoryUsage()
+    setBytes(String(copy, prefixSize + size, String::Copied), linkedType);
+    return true;
+  }
+
   void setType(uint8_t t) {
     _flags &= OWNED_KEY_BIT;
     _flags |= t;
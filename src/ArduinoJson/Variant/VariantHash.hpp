@@ -0,0 +1,118 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2022, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Numbers/convertNumber.hpp>
+#include <ArduinoJson/Variant/VariantData.hpp>
+#include <ArduinoJson/Variant/Visitor.hpp>
+
+#include <stdint.h>  // uint32_t
+
+namespace ARDUINOJSON_NAMESPACE {
+
+inline uint32_t variantHash(const VariantData *var);
+
+// Computes a hash of the content of a variant (FNV-1a), so that two variants
+// that compare equal have the same hash.
+// The order of the elements of an array matters, but the order of the members
+// of an object doesn't: the hashes of the members are added up.
+// The hash depends on the platform and on the configuration, so it should not
+// be stored.
+struct VariantHasher : Visitor<uint32_t> {
+  uint32_t visitArray(const CollectionData &array) {
+    uint32_t hash = begin('[');
+    for (const VariantSlot *s = array.head(); s; s = s->next())
+      hash = add(hash, variantHash(s->data()));
+    return hash;
+  }
+
+  uint32_t visitObject(const CollectionData &object) {
+    uint32_t sum = 0;
+    for (const VariantSlot *s = object.head(); s; s = s->next()) {
+      uint32_t member = add(begin('k'), s->key(), s->keySize());
+      sum += add(member, variantHash(s->data()));
+    }
+    return add(begin('{'), sum);
+  }
+
+  uint32_t visitBoolean(bool value) {
+    return visitUnsignedInteger(value ? 1 : 0);  // because true == 1
+  }
+
+  // Integral floats hash like integers, because 1.0 == 1
+  uint32_t visitFloat(Float value) {
+    if (canConvertNumber<Integer>(value) && Float(Integer(value)) == value)
+      return visitSignedInteger(Integer(value));
+    if (canConvertNumber<UInt>(value) && Float(UInt(value)) == value)
+      return visitUnsignedInteger(UInt(value));
+    return add(begin('f'), &value, sizeof(value));
+  }
+
+  uint32_t visitSignedInteger(Integer value) {
+    return visitUnsignedInteger(UInt(value));
+  }
+
+  uint32_t visitUnsignedInteger(UInt value) {
+    uint32_t hash = begin('i');
+    for (size_t i = 0; i < sizeof(UInt); i++) {
+      hash = add(hash, uint8_t(value));
+      value >>= 8;
+    }
+    return hash;
+  }
+
+  uint32_t visitNull() {
+    return begin('n');
+  }
+
+  uint32_t visitRawJson(const char *data, size_t n) {
+    return add(begin('r'), data, n);
+  }
+
+  uint32_t visitString(const char *s, size_t n) {
+    return add(begin('s'), s, n);
+  }
+
+  uint32_t visitBinary(const uint8_t *data, size_t n) {
+    return add(begin('b'), data, n);
+  }
+
+  uint32_t visitExtension(int8_t type, const uint8_t *data, size_t n) {
+    return add(add(begin('x'), uint8_t(type)), data, n);
+  }
+
+ private:
+  static uint32_t begin(char tag) {
+    return add(2166136261UL, uint8_t(tag));
+  }
+
+  static uint32_t add(uint32_t hash, uint8_t byte) {
+    return (hash ^ byte) * 16777619UL;
+  }
+
+  static uint32_t add(uint32_t hash, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+      hash = add(hash, uint8_t(value));
+      value >>= 8;
+    }
+    return hash;
+  }
+
+  static uint32_t add(uint32_t hash, const void *data, size_t n) {
+    const uint8_t *p = reinterpret_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < n; i++)
+      hash = add(hash, p[i]);
+    return hash;
+  }
+};
+
+inline uint32_t variantHash(const VariantData *var) {
+  VariantHasher hasher;
+  if (!var)
+    return hasher.visitNull();
+  return var->resolve()->accept(hasher);
+}
+
+}  // namespace ARDUINOJSON_NAMESPACE
@@ -26,7 +26,7 @@ inline T VariantData::asIntegral() const {
       return convertNumber<T>(_content.asSignedInteger);
     case VALUE_IS_LINKED_STRING:
     case VALUE_IS_OWNED_STRING:
-      return parseNumber<T>(_content.asString.data);
+      return parseNumber<T>(stringData());
     case VALUE_IS_FLOAT:
       return convertNumber<T>(_content.asFloat);
     default:
@@ -62,7 +62,7 @@ inline T VariantData::asFloat() const {
       return static_cast<T>(_content.asSignedInteger);
     case VALUE_IS_LINKED_STRING:
     case VALUE_IS_OWNED_STRING:
-      return parseNumber<T>(_content.asString.data);
+      return parseNumber<T>(stringData());
     case VALUE_IS_FLOAT:
       return static_cast<T>(_content.asFloat);
     default:
@@ -73,17 +73,35 @@ inline T VariantData::asFloat() const {
 inline String VariantData::asString() const {
   switch (type()) {
     case VALUE_IS_LINKED_STRING:
-      return String(_content.asString.data, _content.asString.size,
-                    String::Linked);
+      return String(stringData(), stringSize(), String::Linked);
     case VALUE_IS_OWNED_STRING:
-      return String(_content.asString.data, _content.asString.size,
-                    String::Copied);
+      return String(stringData(), stringSize(), String::Copied);
+    default:
+      return String();
+  }
+}
+
+inline String VariantData::asBinary() const {
+  switch (type()) {
+    case VALUE_IS_LINKED_BINARY:
+    case VALUE_IS_LINKED_EXTENSION:
+      return String(stringData(), stringSize(), String::Linked);
+    case VALUE_IS_OWNED_BINARY:
+    case VALUE_IS_OWNED_EXTENSION:
+      return String(stringData(), stringSize(), String::Copied);
     default:
       return String();
   }
 }
 
 inline bool VariantData::copyFrom(const VariantData &src, MemoryPool *pool) {
+  if ((src._flags & OWNED_VALUE_BIT) && pool->owns(src.stringData())) {
+    // the string is already in this pool, so the copy refers to it
+    setType(src.type());
+    _content.asOwnedString.offset = makeRelative(this, src.stringData());
+    _content.asOwnedString.size = src.stringSize();
+    return true;
+  }
   switch (src.type()) {
     case VALUE_IS_ARRAY:
       return toArray().copyFrom(src._content.asCollection, pool);
@@ -95,9 +113,13 @@ inline bool VariantData::copyFrom(const VariantData &src, MemoryPool *pool) {
                          getStringStoragePolicy(value));
     }
     case VALUE_IS_OWNED_RAW:
-      return storeOwnedRaw(
-          serialized(src._content.asString.data, src._content.asString.size),
-          pool);
+      return storeOwnedRaw(serialized(src.stringData(), src.stringSize()),
+                           pool);
+    case VALUE_IS_OWNED_BINARY:
+    case VALUE_IS_OWNED_EXTENSION:
+      return storeBytes(0, src.stringData(), src.stringSize(),
+                        static_cast<uint8_t>(src.type() & ~OWNED_VALUE_BIT),
+                        pool);
     default:
       setType(src.type());
       _content = src._content;
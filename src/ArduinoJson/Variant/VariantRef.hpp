@@ -51,6 +51,11 @@ class VariantRefBase : public VariantTag {
     return variantNesting(_data);
   }
 
+  // Variants that compare equal have the same hash, see VariantHasher
+  FORCE_INLINE uint32_t hash() const {
+    return variantHash(_data);
+  }
+
   size_t size() const {
     return variantSize(_data);
   }
@@ -7,8 +7,11 @@
 #include <ArduinoJson/Polyfills/integer.hpp>
 #include <ArduinoJson/Polyfills/limits.hpp>
 #include <ArduinoJson/Polyfills/type_traits.hpp>
+#include <ArduinoJson/Strings/StringAdapters.hpp>
 #include <ArduinoJson/Variant/VariantContent.hpp>
 
+#include <string.h>  // memchr, strlen
+
 namespace ARDUINOJSON_NAMESPACE {
 
 typedef int_t<ARDUINOJSON_SLOT_OFFSET_SIZE * 8>::type VariantSlotDiff;
@@ -19,10 +22,24 @@ class VariantSlot {
   // (+20% on ESP8266 for example)
   VariantContent _content;
   uint8_t _flags;
+#if ARDUINOJSON_SLOT_KEY_HASH
+  uint8_t _keyHash;  // in the padding before _next, see stringHash()
+#endif
+#if ARDUINOJSON_SLOT_KEY_SIZE
+  uint16_t _keySize;  // in the padding before _next, see keySize()
+#endif
   VariantSlotDiff _next;
-  const char* _key;
+  union {
+    const char* _linkedKey;
+    ptrdiff_t _ownedKey;  // relative to this, see RelativePointer.hpp
+  };
 
  public:
+#if ARDUINOJSON_SLOT_KEY_SIZE
+  // Longer keys fall back to strlen()
+  static const uint16_t keySizeOverflow = 0xFFFF;
+#endif
+
   // Must be a POD!
   // - no constructor
   // - no destructor
@@ -78,32 +95,77 @@ class VariantSlot {
 
   void setKey(String k) {
     ARDUINOJSON_ASSERT(k);
-    if (k.isLinked())
+    if (k.isLinked()) {
       _flags &= VALUE_MASK;
-    else
+      _linkedKey = k.c_str();
+    } else {
       _flags |= OWNED_KEY_BIT;
-    _key = k.c_str();
+      _ownedKey = makeRelative(this, k.c_str());
+    }
+    // The key is read as a C string, so a key that contains a NUL (for
+    // example, "\u0000" in JSON) stops there, like strlen() would.
+    // Unlike strlen(), memchr() stops at the known size.
+    size_t n = k.size();
+    const void* nul = memchr(k.c_str(), 0, n);
+    if (nul)
+      n = size_t(static_cast<const char*>(nul) - k.c_str());
+#if ARDUINOJSON_SLOT_KEY_HASH
+    _keyHash = stringHash(adaptString(k.c_str(), n));
+#endif
+#if ARDUINOJSON_SLOT_KEY_SIZE
+    _keySize = uint16_t(n < keySizeOverflow ? n : keySizeOverflow);
+#endif
   }
 
   const char* key() const {
-    return _key;
+    if (ownsKey())
+      return resolveRelative<const char>(this, _ownedKey);
+    return _linkedKey;
+  }
+
+  size_t keySize() const {
+#if ARDUINOJSON_SLOT_KEY_SIZE
+    if (_keySize != keySizeOverflow)
+      return _keySize;
+#endif
+    const char* k = key();
+    return k ? strlen(k) : 0;
+  }
+
+  String keyString() const {
+    return String(key(), keySize(),
+                  ownsKey() ? String::Copied : String::Linked);
   }
 
   bool ownsKey() const {
     return (_flags & OWNED_KEY_BIT) != 0;
   }
 
+#if ARDUINOJSON_SLOT_KEY_HASH
+  uint8_t keyHash() const {
+    return _keyHash;
+  }
+#endif
+
   void clear() {
     _next = 0;
     _flags = 0;
-    _key = 0;
+#if ARDUINOJSON_SLOT_KEY_HASH
+    _keyHash = 0;
+#endif
+#if ARDUINOJSON_SLOT_KEY_SIZE
+    _keySize = 0;
+#endif
+    _linkedKey = 0;
   }
 
+  // Called when the strings moved by stringDistance and the variants moved by
+  // variantDistance, relative to this slot.
   void movePointers(ptrdiff_t stringDistance, ptrdiff_t variantDistance) {
     if (_flags & OWNED_KEY_BIT)
-      _key += stringDistance;
+      _ownedKey += stringDistance;
     if (_flags & OWNED_VALUE_BIT)
-      _content.asString.data += stringDistance;
+      _content.asOwnedString.offset += stringDistance;
     if (_flags & COLLECTION_MASK)
       _content.asCollection.movePointers(stringDistance, variantDistance);
   }
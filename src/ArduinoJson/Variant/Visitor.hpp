@@ -49,6 +49,14 @@ struct Visitor {
   TResult visitString(const char *, size_t) {
     return TResult();
   }
+
+  TResult visitBinary(const uint8_t *, size_t) {
+    return TResult();
+  }
+
+  TResult visitExtension(int8_t, const uint8_t *, size_t) {
+    return TResult();
+  }
 };
 
 }  // namespace ARDUINOJSON_NAMESPACE